@@ -273,6 +273,11 @@ macro(rapidcsv_build)
                         [<PRIVATE|PUBLIC|INTERFACE> <item>...]...)
         #]======================]
     target_link_libraries(rapidcsv INTERFACE ${CONVERTERLIB})
+
+    # 'include/rapidcsv/aggregate.h' runs group-by on worker threads. Linked for every consumer of the
+    # target (see README 'Installation'), as a header-only target cannot tell which headers are included.
+    find_package(Threads REQUIRED)
+    target_link_libraries(rapidcsv INTERFACE Threads::Threads)
 endmacro()
 
 # Helper function to ecapsulate install logic
@@ -0,0 +1,524 @@
+/*
+ * aggregate.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <rapidcsv/view.h>
+#include <rapidcsv/hashindex.h>
+
+
+namespace rapidcsv
+{
+  // column-name of a column, or its index if the Document has no column names or the name is empty.
+  inline std::string _getColumnLabel(const Document& pDocument, const size_t pColumnIdx)
+  {
+    if ( (pDocument._getLabelParams().mColumnNameFlg == FlgColumnName::CN_PRESENT) &&
+         (pDocument.GetColumnCount() > pColumnIdx) )
+    {
+      const std::string columnName = pDocument.GetColumnName(pColumnIdx);
+      if (!columnName.empty())
+      {
+        return columnName;
+      }
+    }
+    return std::to_string(pColumnIdx);
+  }
+
+  enum e_AggregateOp
+  {
+    AGG_COUNT = 0,
+    AGG_SUM,
+    AGG_MEAN,
+    AGG_MIN,
+    AGG_MAX
+  };
+
+  /**
+   * @brief     Class representing an aggregate function on a column of CSV document.
+   * @tparam    T_C             type info of the column to be aggregated.
+   *                            T -> can be data-type such as int, double etc ; xOR
+   *                            C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   * @tparam    AGG_OP          aggregate function. 'AGG_SUM' and 'AGG_MEAN' need an arithmetic type 'T', either
+   *                            as is or with 'C ≃ converter::ConvertFromStr_gNaN<T>', for which cells failing
+   *                            conversion are skipped, i.e. not added and not counted in the mean.
+   *                            'AGG_SUM' accumulates in 'int64_t' / 'uint64_t' for integral columns and in 'double'
+   *                            for floating-point columns, i.e. not in the column type, which may overflow.
+   */
+  template< typename T_C, e_AggregateOp AGG_OP >
+  class AggregateParams
+  {
+  public:
+    /**
+     * @brief       Conversion class satisfying concept 'c_S2Tconverter' for a column
+     */
+    using S2Tconv_type = converter::t_S2Tconv_c<T_C>;
+    /**
+     * @brief       return-type either numeric type 'T' or 'variant std::variant<T, std::string>'
+     */
+    using return_type  = typename S2Tconv_type::return_type;
+    /**
+     * @brief       type 'T' of the converted value, same as 'return_type' unless it is a variant
+     */
+    using value_type   = typename S2Tconv_type::value_type;
+
+    /**
+     * @brief       Aggregate function of the column
+     */
+    constexpr static e_AggregateOp aggregateOp = AGG_OP;
+
+    static_assert( (AGG_OP != e_AggregateOp::AGG_SUM && AGG_OP != e_AggregateOp::AGG_MEAN) ||
+                   ( std::is_arithmetic_v<value_type> &&
+                     ( std::is_same_v<return_type, value_type> ||
+                       std::is_same_v<return_type, std::variant<value_type, std::string>> ) ),
+                   "AGG_SUM and AGG_MEAN need an arithmetic column type" );
+
+    /**
+     * @brief       type of the running sum of 'AGG_SUM', and of the result cell.
+     */
+    using sum_type     = std::conditional_t< std::is_floating_point_v<value_type>, double,
+                                             std::conditional_t<std::is_signed_v<value_type>, int64_t, uint64_t> >;
+
+    /**
+     * @brief       Running state of the aggregate for one group.
+     */
+    struct t_state
+    {
+      std::conditional_t< AGG_OP == e_AggregateOp::AGG_MEAN, double,
+                          std::conditional_t<AGG_OP == e_AggregateOp::AGG_SUM, sum_type, return_type> > mValue{};
+      size_t mCount  = 0;  // number of cells, for AGG_SUM / AGG_MEAN only cells converted successfully
+      size_t mPos    = 0;  // position in row-order of 'mValue', for AGG_MIN / AGG_MAX
+      size_t mRowIdx = 0;  // document row index of 'mValue', for AGG_MIN / AGG_MAX
+    };
+
+    /**
+     * @brief   Constructor
+     * @param   pColumnNameIdx        column-name or zero-based column-index of the aggregated column.
+     * @param   pResultColumnName     column-name in the result Document.
+     *                                Default: empty, i.e. 'count(...)', 'sum(...)' etc of the column name.
+     */
+    explicit AggregateParams(const c_sizet_or_string auto& pColumnNameIdx,
+                             const std::string& pResultColumnName = std::string())
+      : _mColumn(pColumnNameIdx)
+      , _mResultColumnName(pResultColumnName)
+    {}
+
+    /**
+     * @brief   Get column index in a Document.
+     * @param   pDocument             'Document' object with CSV data.
+     * @returns zero-based column index.
+     */
+    inline size_t getColumnIdx(const Document& pDocument) const
+    {
+      return _mColumn.resolve(pDocument);
+    }
+
+    /**
+     * @brief   Get column-name in the result Document.
+     * @param   pDocument             'Document' object with CSV data.
+     * @param   pColumnIdx            zero-based column index of the aggregated column.
+     * @returns column name.
+     */
+    std::string getResultColumnName(const Document& pDocument, const size_t pColumnIdx) const
+    {
+      if (!_mResultColumnName.empty())
+      {
+        return _mResultColumnName;
+      }
+
+      static const char* const opNames[] = { "count", "sum", "mean", "min", "max" };
+      return std::string(opNames[AGG_OP]) + "(" + _getColumnLabel(pDocument, pColumnIdx) + ")";
+    }
+
+    /**
+     * @brief   Add a cell to the state of a group.
+     * @param   pState                state of the group.
+     * @param   pCell                 cell of the aggregated column.
+     * @param   pPos                  position of the row in row-order.
+     * @param   pRowIdx               document row index of the cell.
+     */
+    static void accumulate(t_state& pState, const std::string& pCell, const size_t pPos, const size_t pRowIdx)
+    {
+      if constexpr (AGG_OP == e_AggregateOp::AGG_COUNT)
+      {
+        static_cast<void>(pCell);
+      } else if constexpr (AGG_OP == e_AggregateOp::AGG_SUM || AGG_OP == e_AggregateOp::AGG_MEAN) {
+        const return_type value = _S2Tdispatch<S2Tconv_type>(pCell);
+        if constexpr (std::is_same_v<return_type, value_type>)
+        {
+          pState.mValue += static_cast<decltype(pState.mValue)>(value);
+        } else {
+          // the string alternative holds a cell which failed conversion, i.e. NaN
+          const value_type* number = std::get_if<value_type>(&value);
+          if (number == nullptr)
+          {
+            return;
+          }
+          pState.mValue += static_cast<decltype(pState.mValue)>(*number);
+        }
+      } else {
+        return_type value = _S2Tdispatch<S2Tconv_type>(pCell);
+        if ( (pState.mCount == 0) ||
+             ((AGG_OP == e_AggregateOp::AGG_MIN) ? (value < pState.mValue) : (pState.mValue < value)) )
+        {
+          pState.mValue  = std::move(value);
+          pState.mPos    = pPos;
+          pState.mRowIdx = pRowIdx;
+        }
+      }
+      ++pState.mCount;
+    }
+
+    /**
+     * @brief   Merge the state of the same group, computed over other rows.
+     * @param   pState                state of the group, updated.
+     * @param   pOther                state of the group over other rows.
+     */
+    static void merge(t_state& pState, const t_state& pOther)
+    {
+      if constexpr (AGG_OP == e_AggregateOp::AGG_SUM || AGG_OP == e_AggregateOp::AGG_MEAN)
+      {
+        pState.mValue += pOther.mValue;
+      } else if constexpr (AGG_OP == e_AggregateOp::AGG_MIN || AGG_OP == e_AggregateOp::AGG_MAX) {
+        if (pOther.mCount != 0)
+        {
+          const bool isOtherBetter = (AGG_OP == e_AggregateOp::AGG_MIN) ? (pOther.mValue < pState.mValue)
+                                                                        : (pState.mValue < pOther.mValue);
+          const bool isOtherEqual  = !(pOther.mValue < pState.mValue) && !(pState.mValue < pOther.mValue);
+          // equal values keep the first in row-order, i.e. same as single-threaded
+          if ( (pState.mCount == 0) || isOtherBetter || (isOtherEqual && (pOther.mPos < pState.mPos)) )
+          {
+            pState.mValue  = pOther.mValue;
+            pState.mPos    = pOther.mPos;
+            pState.mRowIdx = pOther.mRowIdx;
+          }
+        }
+      }
+      pState.mCount += pOther.mCount;
+    }
+
+    /**
+     * @brief   Write the aggregate of a group as cell of the result Document.
+     * @param   pState                state of the group.
+     * @param   pDocument             'Document' object with CSV data.
+     * @param   pColumnIdx            zero-based column index of the aggregated column.
+     * @param   pCell                 cell of the result, overwritten.
+     */
+    static void write(const t_state& pState, const Document& pDocument, const size_t pColumnIdx, std::string& pCell)
+    {
+      if constexpr (AGG_OP == e_AggregateOp::AGG_COUNT)
+      {
+        _T2Sdispatch<size_t>(pState.mCount, pCell);
+      } else if constexpr (AGG_OP == e_AggregateOp::AGG_SUM) {
+        _T2Sdispatch<sum_type>(pState.mValue, pCell);
+      } else if constexpr (AGG_OP == e_AggregateOp::AGG_MEAN) {
+        _T2Sdispatch<double>(pState.mValue / static_cast<double>(pState.mCount), pCell);
+      } else {
+        // cell text of the minimum/maximum, i.e. without any conversion back to string
+        pCell = pDocument.GetCell<std::string>(pColumnIdx, pState.mRowIdx);
+      }
+    }
+
+  private:
+    const _ColumnRef  _mColumn;
+    const std::string _mResultColumnName;
+  };
+
+  template <typename, typename = void>
+  struct is_AggregateParams : std::false_type {};
+
+  template <typename CAP>
+  struct is_AggregateParams< CAP, std::void_t< typename CAP::t_state,
+                                               decltype(CAP::aggregateOp),
+                                               decltype(&CAP::accumulate),
+                                               decltype(&CAP::merge),
+                                               decltype(&CAP::write)
+                                             >
+                           > : std::true_type {};
+
+  template <typename CAP>
+  concept c_AggregateParams = is_AggregateParams<CAP>::value;
+
+  /**
+   * @brief     Class representing parallelism of 'GroupBy'.
+   */
+  struct GroupByParams
+  {
+    /**
+     * @brief   Constructor
+     * @param   pThreadCount          maximum number of threads, including the calling thread.
+     *                                Default: 0, i.e. 'std::thread::hardware_concurrency()'
+     * @param   pMinRowsPerThread     minimum number of rows for each thread, smaller inputs use fewer threads.
+     *                                Default: 65536
+     */
+    explicit GroupByParams(const size_t pThreadCount = 0,
+                           const size_t pMinRowsPerThread = 65536)
+      : mThreadCount(pThreadCount)
+      , mMinRowsPerThread(pMinRowsPerThread)
+    {}
+
+    /**
+     * @brief   specifies the maximum number of threads.
+     */
+    size_t mThreadCount;
+
+    /**
+     * @brief   specifies the minimum number of rows for each thread.
+     */
+    size_t mMinRowsPerThread;
+  };
+
+  /**
+   * @brief     Class representing a group-by on one or more key columns of a CSV document.
+   *            Rows are split in contiguous ranges, one per thread; each thread aggregates into its own
+   *            hash table and the tables are merged at the end. The result is a new 'Document' with one row
+   *            for each group, in order of the first row of the group, and with the key columns followed by
+   *            one column for each aggregate.
+   * @tparam    T_K                   one for each key column.
+   *                                  T can be data-type such as int, double etc ;   xOR
+   *                                  C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   */
+  template< typename ... T_K >
+  class GroupBy
+  {
+    static_assert(sizeof...(T_K) > 0, "GroupBy needs at least one key column");
+
+  public:
+    /**
+     * @brief   key of the group, converted cell values of the key columns.
+     */
+    using t_key = std::tuple<typename converter::t_S2Tconv_c<T_K>::return_type ...>;
+
+    /**
+     * @brief   Constructor
+     * @param   pParams               parallelism parameters.
+     * @param   pKeyColumnNameIdx     column-name or zero-based column-index, one for each of 'T_K'.
+     */
+    template< c_sizet_or_string ... T_N >
+      requires (sizeof...(T_N) == sizeof...(T_K))
+    explicit GroupBy(const GroupByParams& pParams, const T_N& ... pKeyColumnNameIdx)
+      : _mParams(pParams)
+      , _mKeyColumns{ _ColumnRef(pKeyColumnNameIdx) ... }
+    {}
+
+    /**
+     * @brief   Constructor, using default 'GroupByParams'.
+     * @param   pKeyColumnNameIdx     column-name or zero-based column-index, one for each of 'T_K'.
+     */
+    template< c_sizet_or_string ... T_N >
+      requires (sizeof...(T_N) == sizeof...(T_K))
+    explicit GroupBy(const T_N& ... pKeyColumnNameIdx)
+      : GroupBy(GroupByParams(), pKeyColumnNameIdx ...)
+    {}
+
+    /**
+     * @brief   Aggregate all rows of a Document.
+     * @tparam  AGGtypes              variadic list of AggregateParams satisfying concept 'c_AggregateParams'.
+     * @param   pDocument             'Document' object with CSV data.
+     * @param   pAggs                 aggregate functions, one for each of 'AGGtypes'.
+     * @returns 'Document' with column names, one row per group.
+     */
+    template< c_AggregateParams ... AGGtypes >
+    Document Aggregate(const Document& pDocument, const AGGtypes& ... pAggs) const
+    {
+      return _aggregate(pDocument, pDocument._getDataRowCount(),
+                        [](const size_t pPos) { return pPos; }, pAggs ...);
+    }
+
+    /**
+     * @brief   Aggregate the rows of a view, e.g. 'FilterDocument' or 'FilterSortDocument'.
+     *          Groups are ordered by their first view row.
+     * @tparam  AGGtypes              variadic list of AggregateParams satisfying concept 'c_AggregateParams'.
+     * @param   pView                 view on a 'Document'.
+     * @param   pAggs                 aggregate functions, one for each of 'AGGtypes'.
+     * @returns 'Document' with column names, one row per group.
+     */
+    template< c_AggregateParams ... AGGtypes >
+    Document Aggregate(const _ViewDocument& pView, const AGGtypes& ... pAggs) const
+    {
+      return _aggregate(pView.GetDocument(), pView.GetViewRowCount(),
+                        [viewRowIdxs = _ViewDocument::_getViewRowIdxs(pView)](const size_t pPos) { return viewRowIdxs[pPos]; },
+                        pAggs ...);
+    }
+
+  private:
+    template< c_AggregateParams ... AGGtypes >
+    struct _Group
+    {
+      size_t                                       mFirstPos;
+      size_t                                       mFirstRowIdx;
+      std::tuple<typename AGGtypes::t_state ...>   mStates;
+    };
+
+    template< c_AggregateParams ... AGGtypes, typename F_ROWIDX >
+    Document _aggregate(const Document& pDocument, const size_t pRowCount,
+                        const F_ROWIDX& pRowIdxAt, const AGGtypes& ... pAggs) const
+    {
+      using t_group = _Group<AGGtypes ...>;
+      using t_table = std::unordered_map<t_key, t_group, _HashIndexHasher>;
+
+      std::vector<size_t> keyColumnIdxs;
+      for (const _ColumnRef& keyColumn : _mKeyColumns)
+      {
+        keyColumnIdxs.push_back(keyColumn.resolve(pDocument));
+      }
+      const std::vector<size_t> aggColumnIdxs = { pAggs.getColumnIdx(pDocument) ... };
+      size_t minRowSize = 0;
+      for (const size_t columnIdx : keyColumnIdxs)  minRowSize = std::max(minRowSize, columnIdx + 1);
+      for (const size_t columnIdx : aggColumnIdxs)  minRowSize = std::max(minRowSize, columnIdx + 1);
+
+      const size_t threadCount = _getThreadCount(pRowCount);
+      std::vector<t_table> tables(threadCount);
+      std::vector<std::exception_ptr> errors(threadCount);
+
+      auto aggregateRange = [&](const size_t pThreadIdx)
+      {
+        try
+        {
+          t_table& table = tables[pThreadIdx];
+          const size_t endPos = (pRowCount * (pThreadIdx + 1)) / threadCount;
+          for (size_t pos = (pRowCount * pThreadIdx) / threadCount; pos < endPos; ++pos)
+          {
+            const size_t rowIdx = pRowIdxAt(pos);
+            const Document::t_dataRow& row = pDocument._getDataRow(rowIdx);
+            if (row.size() < minRowSize)
+            {
+              static const std::string errMsg("rapidcsv::GroupBy::Aggregate() : requested column index is more than row.size()");
+              RAPIDCSV_DEBUG_LOG(errMsg << " : rowIdx=" << rowIdx << " , row.size()=" << row.size());
+              throw std::out_of_range(errMsg);
+            }
+
+            auto itGroup = table.try_emplace(_RowKey<T_K ...>::make(row, keyColumnIdxs),
+                                             t_group{ pos, rowIdx, {} }).first;
+            [&]<size_t ... I>(std::index_sequence<I ...>)
+            {
+              (AGGtypes::accumulate(std::get<I>(itGroup->second.mStates), row[aggColumnIdxs[I]], pos, rowIdx), ...);
+            }(std::index_sequence_for<AGGtypes ...>{});
+          }
+        }
+        catch (...)
+        {
+          errors[pThreadIdx] = std::current_exception();
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (size_t threadIdx = 1; threadIdx < threadCount; ++threadIdx)
+      {
+        threads.emplace_back(aggregateRange, threadIdx);
+      }
+      aggregateRange(0);
+      for (std::thread& thread : threads)
+      {
+        thread.join();
+      }
+      for (const std::exception_ptr& error : errors)
+      {
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+      }
+
+      // merge, groups of a later thread start at a later position
+      t_table& result = tables[0];
+      for (size_t threadIdx = 1; threadIdx < threadCount; ++threadIdx)
+      {
+        for (auto& [key, group] : tables[threadIdx])
+        {
+          auto [itGroup, isInserted] = result.try_emplace(key, group);
+          if (!isInserted)
+          {
+            [&]<size_t ... I>(std::index_sequence<I ...>)
+            {
+              (AGGtypes::merge(std::get<I>(itGroup->second.mStates), std::get<I>(group.mStates)), ...);
+            }(std::index_sequence_for<AGGtypes ...>{});
+          }
+        }
+        t_table().swap(tables[threadIdx]);
+      }
+
+      std::vector<const t_group*> groups;
+      groups.reserve(result.size());
+      for (const auto& keyGroup : result)
+      {
+        groups.push_back(&keyGroup.second);
+      }
+      std::sort(groups.begin(), groups.end(),
+                [](const t_group* pLhs, const t_group* pRhs) { return pLhs->mFirstPos < pRhs->mFirstPos; });
+
+      Document resultDocument(std::string(), LabelParams(FlgColumnName::CN_PRESENT, FlgRowName::RN_MISSING),
+                              SeparatorParams(), LineReaderParams());
+      std::vector<std::string> columnNames;
+      for (const size_t columnIdx : keyColumnIdxs)
+      {
+        columnNames.push_back(_getColumnLabel(pDocument, columnIdx));
+      }
+      [&]<size_t ... I>(std::index_sequence<I ...>)
+      {
+        (columnNames.push_back(pAggs.getResultColumnName(pDocument, aggColumnIdxs[I])), ...);
+      }(std::index_sequence_for<AGGtypes ...>{});
+
+      std::vector<Document::t_dataRow> resultRows(groups.size());
+      for (size_t groupIdx = 0; groupIdx < groups.size(); ++groupIdx)
+      {
+        const t_group& group = *groups[groupIdx];
+        Document::t_dataRow& resultRow = resultRows[groupIdx];
+        resultRow.resize(columnNames.size());
+        // key cells are copied from the first row of the group
+        const Document::t_dataRow& firstRow = pDocument._getDataRow(group.mFirstRowIdx);
+        for (size_t keyIdx = 0; keyIdx < keyColumnIdxs.size(); ++keyIdx)
+        {
+          resultRow[keyIdx] = firstRow[keyColumnIdxs[keyIdx]];
+        }
+        [&]<size_t ... I>(std::index_sequence<I ...>)
+        {
+          (AGGtypes::write(std::get<I>(group.mStates), pDocument, aggColumnIdxs[I],
+                           resultRow[keyColumnIdxs.size() + I]), ...);
+        }(std::index_sequence_for<AGGtypes ...>{});
+      }
+      for (size_t columnIdx = 0; columnIdx < columnNames.size(); ++columnIdx)
+      {
+        resultDocument.SetColumnName(columnIdx, columnNames[columnIdx]);
+      }
+      resultDocument.AppendRows_VecStr(std::move(resultRows));
+      return resultDocument;
+    }
+
+    size_t _getThreadCount(const size_t pRowCount) const
+    {
+      size_t threadCount = (_mParams.mThreadCount != 0) ? _mParams.mThreadCount
+                                                        : static_cast<size_t>(std::thread::hardware_concurrency());
+      if (_mParams.mMinRowsPerThread != 0)
+      {
+        threadCount = std::min(threadCount, pRowCount / _mParams.mMinRowsPerThread);
+      }
+      return std::max<size_t>(threadCount, 1);
+    }
+
+    const GroupByParams           _mParams;
+    const std::vector<_ColumnRef> _mKeyColumns;
+  };
+}
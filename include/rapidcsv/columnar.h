@@ -0,0 +1,1157 @@
+/*
+ * columnar.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string_view>
+
+#include <rapidcsv/view.h>
+
+
+namespace rapidcsv
+{
+  /**
+   * @brief     Class representing a CSV document, with column-major (struct-of-arrays) storage.
+   *            Each column is held in one contiguous vector of cells, hence column scans and
+   *            column insert/remove are sequential memory access, while row access is a gather.
+   *            Labels, separator and line-reader parameters are handled same as 'Document'.
+   *            Rows are always padded to full column count.
+   *            Low-cardinality columns can be dictionary-encoded, i.e. stored as a table of distinct
+   *            values plus a 32-bit code per row.
+   */
+  class ColumnarDocument
+  {
+  public:
+
+    /**
+     * @brief   type definition for a column of strings.
+     */
+    using t_dataColumn = std::vector<std::string>;
+
+    /**
+     * @brief   code returned by 'FindCode()' when value is not in the dictionary.
+     */
+    static constexpr uint32_t s_NoCode = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief   Constructor
+     * @param   pPath                 specifies the path of an existing CSV-file to populate the Document
+     *                                data with.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   pEncodeColumns        column label names to be dictionary-encoded at load (optional argument).
+     */
+    explicit ColumnarDocument(const std::string& pPath = std::string(),
+                              const LabelParams& pLabelParams = LabelParams(),
+                              const SeparatorParams& pSeparatorParams = SeparatorParams(),
+                              const LineReaderParams& pLineReaderParams = LineReaderParams(),
+                              const std::vector<std::string>& pEncodeColumns = std::vector<std::string>())
+      : _mDocument(pPath, pLabelParams, pSeparatorParams, pLineReaderParams)
+      , _mColumns()
+      , _mRowCount(0)
+    {
+      _extractColumns(pEncodeColumns);
+    }
+
+    /**
+     * @brief   Constructor
+     * @param   pStream               specifies a binary input stream to read CSV data from.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   pEncodeColumns        column label names to be dictionary-encoded at load (optional argument).
+     */
+    explicit ColumnarDocument(std::istream& pStream,
+                              const LabelParams& pLabelParams = LabelParams(),
+                              const SeparatorParams& pSeparatorParams = SeparatorParams(),
+                              const LineReaderParams& pLineReaderParams = LineReaderParams(),
+                              const std::vector<std::string>& pEncodeColumns = std::vector<std::string>())
+      : _mDocument(pStream, pLabelParams, pSeparatorParams, pLineReaderParams)
+      , _mColumns()
+      , _mRowCount(0)
+    {
+      _extractColumns(pEncodeColumns);
+    }
+
+    /**
+     * @brief   Constructor, copies data and labels of a row-major Document.
+     * @param   pDocument             Document to be copied.
+     */
+    explicit ColumnarDocument(const Document& pDocument)
+      : _mDocument(pDocument)
+      , _mColumns()
+      , _mRowCount(0)
+    {
+      _extractColumns(std::vector<std::string>());
+    }
+
+    /**
+     * @brief   Constructor, moves data and labels of a row-major Document.
+     * @param   pDocument             Document to be moved.
+     */
+    explicit ColumnarDocument(Document&& pDocument)
+      : _mDocument()
+      , _mColumns()
+      , _mRowCount(0)
+    {
+      // Document has no move-constructor, hence the cells are moved out before copying labels.
+      Document::t_dataTable data(std::move(pDocument._mData));
+      _mDocument = pDocument;
+      _mDocument._mData = std::move(data);
+      _extractColumns(std::vector<std::string>());
+    }
+
+    /**
+     * @brief   Read Document data from file.
+     * @param   pPath                 specifies the path of an existing CSV-file to populate the Document
+     *                                data with.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   pEncodeColumns        column label names to be dictionary-encoded at load (optional argument).
+     */
+    void Load(const std::string& pPath,
+              const LabelParams& pLabelParams = LabelParams(),
+              const SeparatorParams& pSeparatorParams = SeparatorParams(),
+              const LineReaderParams& pLineReaderParams = LineReaderParams(),
+              const std::vector<std::string>& pEncodeColumns = std::vector<std::string>())
+    {
+      _mDocument.Load(pPath, pLabelParams, pSeparatorParams, pLineReaderParams);
+      _extractColumns(pEncodeColumns);
+    }
+
+    /**
+     * @brief   Read Document data from stream.
+     * @param   pStream               specifies a binary input stream to read CSV data from.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   pEncodeColumns        column label names to be dictionary-encoded at load (optional argument).
+     */
+    void Load(std::istream& pStream,
+              const LabelParams& pLabelParams = LabelParams(),
+              const SeparatorParams& pSeparatorParams = SeparatorParams(),
+              const LineReaderParams& pLineReaderParams = LineReaderParams(),
+              const std::vector<std::string>& pEncodeColumns = std::vector<std::string>())
+    {
+      _mDocument.Load(pStream, pLabelParams, pSeparatorParams, pLineReaderParams);
+      _extractColumns(pEncodeColumns);
+    }
+
+    /**
+     * @brief   Write Document data to file.
+     * @param   pPath                 optionally specifies the path where the CSV-file will be created
+     *                                (if not specified, the original path provided when creating or
+     *                                loading the Document data will be used).
+     */
+    void Save(const std::string& pPath = std::string())
+    {
+      if (!pPath.empty())
+      {
+        _mDocument._mPath = pPath;
+      }
+      ToDocument().Save();
+    }
+
+    /**
+     * @brief   Write Document data to stream.
+     * @param   pStream               specifies a binary output stream to write the data to.
+     */
+    void Save(std::ostream& pStream) const
+    {
+      ToDocument().Save(pStream);
+    }
+
+    /**
+     * @brief   Convert to a row-major Document.
+     * @returns Document with copy of data and labels.
+     */
+    Document ToDocument() const
+    {
+      Document document(_mDocument);
+      document._mData.assign(_mRowCount, Document::t_dataRow(_mColumns.size()));
+      for (size_t columnIdx = 0; columnIdx < _mColumns.size(); ++columnIdx)
+      {
+        const _Column& column = _mColumns[columnIdx];
+        for (size_t rowIdx = 0; rowIdx < _mRowCount; ++rowIdx)
+        {
+          document._mData[rowIdx][columnIdx] = column[rowIdx];
+        }
+      }
+      return document;
+    }
+
+    /**
+     * @brief   Clears loaded Document data.
+     *
+     */
+    void Clear()
+    {
+      _mDocument.Clear();
+      _mColumns.clear();
+      _mRowCount = 0;
+    }
+
+    /**
+     * @brief   Get column index either by it's index or name.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns zero-based column index.
+     */
+    inline size_t GetColumnIdx(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return _mDocument.GetColumnIdx(pColumnNameIdx);
+    }
+
+    /**
+     * @brief   Get column either by it's index or name. Cells are read sequentially from the column vector.
+     *          For a dictionary-encoded column each distinct value is converted once, and the converted
+     *          values are gathered by code.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'vector<R>' of column data. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     *          On conversion success variant has the converted value,
+     *          else the string value which caused failure during conversion.
+     */
+    template< typename T_C >
+    std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>
+    GetColumn(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      const _Column& columnData = _getColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::GetColumn()");
+      std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> column;
+      column.reserve(_mRowCount);
+      if (columnData.mEncoded)
+      {
+        const std::vector<std::optional<typename converter::t_S2Tconv_c<T_C>::return_type>> dictionary =
+          _convertDictionary<T_C>(columnData);
+        for (const uint32_t code : columnData.mCodes)
+        {
+          column.push_back(*dictionary[code]);
+        }
+      } else {
+        for (const std::string& cell : columnData.mCells)
+        {
+          column.push_back(_S2Tdispatch<T_C>(cell));
+        }
+      }
+      return column;
+    }
+
+    /**
+     * @brief   Get column either by it's index or name.
+     * @tparam  CONV_S2T              conversion function.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'vector<R>' of column data.
+     */
+    template< auto (*CONV_S2T)(const std::string&) >
+    inline std::vector< typename converter::f_S2Tconv_c< CONV_S2T >::return_type >
+    GetColumn(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return GetColumn< converter::f_S2Tconv_c< CONV_S2T > >(pColumnNameIdx);
+    }
+
+    /**
+     * @brief   Get column of strings either by it's index or name, without copy.
+     *          For a dictionary-encoded column use 'GetColumnCodes()' and 'GetColumnDictionary()'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns reference to contiguous column data.
+     */
+    inline const t_dataColumn& GetColumn_VecStr(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      const _Column& column = _getColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::GetColumn_VecStr()");
+      if (column.mEncoded)
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::GetColumn_VecStr() : column is dictionary-encoded");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnNameIdx='" << pColumnNameIdx << "'");
+        throw std::out_of_range(errMsg);
+      }
+      return column.mCells;
+    }
+
+    /**
+     * @brief   Set column either by it's index or name.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'vector<R>' of column data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromVal_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    void SetColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                   const std::vector<typename converter::t_T2Sconv_c<T_C>::input_type>& pColumn)
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      _resizeRows(pColumn.size());
+      _resizeColumns(columnIdx + 1);
+
+      _Column& columnData = _mColumns[columnIdx];
+      size_t rowIdx = 0;
+      for (auto itCell = pColumn.begin(); itCell != pColumn.end(); ++itCell, ++rowIdx)
+      {
+        columnData.setVal<T_C>(rowIdx, *itCell);
+      }
+    }
+
+    /**
+     * @brief   Remove column either by it's index or name.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     */
+    void RemoveColumn(const c_sizet_or_string auto& pColumnNameIdx)
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      _getColumn(columnIdx, "rapidcsv::ColumnarDocument::RemoveColumn()");
+      if (_mDocument._mLabelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT &&
+          columnIdx < _mDocument._mIdxColumnNames.size())
+      {
+        _mDocument._mIdxColumnNames.erase(_mDocument._mIdxColumnNames.begin() + static_cast<ssize_t>(columnIdx));
+      }
+      _mColumns.erase(_mColumns.begin() + static_cast<ssize_t>(columnIdx));
+
+      _mDocument._updateColumnNames("rapidcsv::ColumnarDocument::RemoveColumn()");
+    }
+
+    /**
+     * @brief   Insert column at specified index.
+     * @tparam  T_C                   can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pColumnIdx            zero-based column index.
+     * @param   pColumn               'vector<R>' of column data (optional argument). By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromVal_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     * @param   pColumnName           column label name (optional argument)
+     */
+    template< typename T_C >
+    void InsertColumn(const size_t pColumnIdx,
+                      const std::vector<typename converter::t_T2Sconv_c<T_C>::input_type>& pColumn
+                          = std::vector<typename converter::t_T2Sconv_c<T_C>::input_type>(),
+                      const std::string& pColumnName = std::string())
+    {
+      if (_mDocument._mLabelParams.mColumnNameFlg == FlgColumnName::CN_MISSING && !pColumnName.empty())
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::InsertColumn() : _mLabelParams.mColumnNameFlg = FlgColumnName::CN_MISSING -> can't process Column-Name");
+        throw std::out_of_range(errMsg);
+      }
+
+      if (_mDocument._mLabelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT && pColumnName.empty())
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::InsertColumn() : _mLabelParams.mColumnNameFlg = FlgColumnName::CN_PRESENT -> Column-Name can't be empty string");
+        throw std::out_of_range(errMsg);
+      }
+
+      if (pColumnIdx > _mColumns.size())
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::InsertColumn() : 'pColumnIdx' beyond column count");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnIdx=" << pColumnIdx << " columnCount=" << _mColumns.size());
+        throw std::out_of_range(errMsg);
+      }
+
+      _resizeRows(pColumn.size());
+      t_dataColumn column(_mRowCount);
+      size_t rowIdx = 0;
+      for (auto itCell = pColumn.begin(); itCell != pColumn.end(); ++itCell, ++rowIdx)
+      {
+        _T2Sdispatch<T_C>(*itCell, column[rowIdx]);
+      }
+      _mColumns.insert(_mColumns.begin() + static_cast<ssize_t>(pColumnIdx), _Column(std::move(column)));
+
+      if (_mDocument._mLabelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT)
+      {
+        std::vector<std::string>& columnNames = _mDocument._mIdxColumnNames;
+        columnNames.insert(columnNames.begin() + static_cast<ssize_t>(std::min(pColumnIdx, columnNames.size())), pColumnName);
+      }
+
+      _mDocument._updateColumnNames("rapidcsv::ColumnarDocument::InsertColumn()");
+    }
+
+    /**
+     * @brief   Get number of data columns (excluding label columns).
+     * @returns column count.
+     */
+    inline size_t GetColumnCount() const
+    {
+      return _mColumns.size();
+    }
+
+    /**
+     * @brief   Get row index either by it's index or name.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns zero-based row index.
+     */
+    inline size_t GetRowIdx(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return _mDocument.GetRowIdx(pRowNameIdx);
+    }
+
+    /**
+     * @brief   Get row either by it's index or name. Cells are gathered from each column.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'tuple<R...>' of row data. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename ... T_C >
+    std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+    GetRow(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      const size_t rowIdx = _checkRowIdx(GetRowIdx(pRowNameIdx), "rapidcsv::ColumnarDocument::GetRow()");
+
+      if( _mColumns.size() < sizeof...(T_C) )
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::GetRow(pRowNameIdx) :: ERROR : row-size less than tuple size");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowNameIdx='" << pRowNameIdx << "' , row-size=" << _mColumns.size()
+                                  << " , tuple-size=" << sizeof...(T_C) );
+        throw std::out_of_range(errMsg);
+      }
+
+      return _getRow<T_C...>(rowIdx, std::index_sequence_for<T_C...>{});
+    }
+
+    /**
+     * @brief   Get row either by it's index or name.
+     * @tparam  CONV_S2T              conversion function of type 'R (*CONV_S2T)(const std::string&)'.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'tuple<R...>' of row data.
+     */
+    template< auto ... CONV_S2T >
+    inline std::tuple< typename converter::f_S2Tconv_c< CONV_S2T >::return_type... >
+    GetRow(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return GetRow< converter::f_S2Tconv_c< CONV_S2T >... >(pRowNameIdx);
+    }
+
+    /**
+     * @brief   Get row either by it's index or name.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'vector<std::string>' of row data
+     */
+    std::vector<std::string>
+    GetRow_VecStr(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      const size_t rowIdx = _checkRowIdx(GetRowIdx(pRowNameIdx), "rapidcsv::ColumnarDocument::GetRow_VecStr()");
+      std::vector<std::string> row;
+      row.reserve(_mColumns.size());
+      for (const _Column& column : _mColumns)
+      {
+        row.push_back(column[rowIdx]);
+      }
+      return row;
+    }
+
+    /**
+     * @brief   Set row either by it's index or name.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @param   pRow                  'tuple<R...>' of row data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromVal_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename ... T_C >
+    void SetRow(const c_sizet_or_string auto& pRowNameIdx,
+                const std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>& pRow)
+    {
+      const size_t rowIdx = GetRowIdx(pRowNameIdx);
+      _resizeRows(rowIdx + 1);
+      _resizeColumns(sizeof...(T_C));
+      _setRow<T_C...>(rowIdx, pRow, std::index_sequence_for<T_C...>{});
+    }
+
+    /**
+     * @brief   Set row either by it's index or name.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @param   pRow                  'vector<string>' of row data.
+     */
+    void SetRow_VecStr(const c_sizet_or_string auto& pRowNameIdx,
+                       const std::vector<std::string>& pRow)
+    {
+      const size_t rowIdx = GetRowIdx(pRowNameIdx);
+      _resizeRows(rowIdx + 1);
+      _resizeColumns(pRow.size());
+      for (size_t columnIdx = 0; columnIdx < pRow.size(); ++columnIdx)
+      {
+        _mColumns[columnIdx].set(rowIdx, pRow[columnIdx]);
+      }
+    }
+
+    /**
+     * @brief   Remove row either by it's index or name.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     */
+    void RemoveRow(const c_sizet_or_string auto& pRowNameIdx)
+    {
+      const size_t rowIdx = _checkRowIdx(GetRowIdx(pRowNameIdx), "rapidcsv::ColumnarDocument::RemoveRow()");
+      _mDocument._removeRowName(rowIdx);
+      for (_Column& column : _mColumns)
+      {
+        column.erase(rowIdx);
+      }
+      --_mRowCount;
+    }
+
+    /**
+     * @brief   Insert row at specified index.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;    xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pRowIdx               zero-based row index.
+     * @param   pRow                  'tuple<R...>' of row data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromVal_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     * @param   pRowName              row label name (optional argument).
+     */
+    template< typename ... T_C >
+    void InsertRow(const size_t pRowIdx,
+                   const std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>& pRow
+                       = std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>(),
+                   const std::string& pRowName = std::string())
+    {
+      _insertEmptyRow(pRowIdx, sizeof...(T_C), pRowName, "rapidcsv::ColumnarDocument::InsertRow()");
+      _setRow<T_C...>(pRowIdx, pRow, std::index_sequence_for<T_C...>{});
+    }
+
+    /**
+     * @brief   Insert row at specified index.
+     * @param   pRowIdx               zero-based row index.
+     * @param   pRow                  'vector<string>' of row data (optional argument).
+     * @param   pRowName              row label name (optional argument).
+     */
+    void InsertRow_VecStr(const size_t pRowIdx,
+                          const std::vector<std::string>& pRow
+                                         = std::vector<std::string>(),
+                          const std::string& pRowName = std::string())
+    {
+      _insertEmptyRow(pRowIdx, pRow.size(), pRowName, "rapidcsv::ColumnarDocument::InsertRow_VecStr()");
+      for (size_t columnIdx = 0; columnIdx < pRow.size(); ++columnIdx)
+      {
+        _mColumns[columnIdx].set(pRowIdx, pRow[columnIdx]);
+      }
+    }
+
+    /**
+     * @brief   Get number of data rows (excluding label rows).
+     * @returns row count.
+     */
+    inline size_t GetRowCount() const
+    {
+      return _mRowCount;
+    }
+
+    /**
+     * @brief   Get cell either by it's index or name.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns cell data of type R. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    typename converter::t_S2Tconv_c<T_C>::return_type
+    GetCell(const c_sizet_or_string auto& pColumnNameIdx,
+            const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      const size_t rowIdx = GetRowIdx(pRowNameIdx);
+
+      return _S2Tdispatch<T_C>(_mColumns.at(columnIdx).at(rowIdx));
+    }
+
+    /**
+     * @brief   Get cell either by it's index or name.
+     * @tparam  CONV_S2T              conversion function.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns cell data of type R.
+     */
+    template< auto (*CONV_S2T)(const std::string&) >
+    inline typename converter::f_S2Tconv_c< CONV_S2T >::return_type
+    GetCell(const c_sizet_or_string auto& pColumnNameIdx,
+            const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return GetCell< converter::f_S2Tconv_c< CONV_S2T > >(pColumnNameIdx, pRowNameIdx);
+    }
+
+    /**
+     * @brief   Set cell either by it's index or name.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @param   pCell                 cell data.
+     */
+    template< typename T_C >
+    void SetCell(const c_sizet_or_string auto& pColumnNameIdx,
+                 const c_sizet_or_string auto& pRowNameIdx,
+                 const typename converter::t_T2Sconv_c<T_C>::input_type& pCell)
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      const size_t rowIdx = GetRowIdx(pRowNameIdx);
+      _resizeRows(rowIdx + 1);
+      _resizeColumns(columnIdx + 1);
+
+      _mColumns[columnIdx].setVal<T_C>(rowIdx, pCell);
+    }
+
+    /**
+     * @brief   Dictionary-encode a column either by it's index or name, i.e. store distinct values once
+     *          and a 32-bit code per row. All Get/Set functions work as before on an encoded column.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     */
+    void EncodeColumn(const c_sizet_or_string auto& pColumnNameIdx)
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      _getColumn(columnIdx, "rapidcsv::ColumnarDocument::EncodeColumn()");
+      _mColumns[columnIdx].encodeColumn();
+    }
+
+    /**
+     * @brief   Revert a dictionary-encoded column either by it's index or name, to plain cells.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     */
+    void DecodeColumn(const c_sizet_or_string auto& pColumnNameIdx)
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      _getColumn(columnIdx, "rapidcsv::ColumnarDocument::DecodeColumn()");
+      _mColumns[columnIdx].decodeColumn();
+    }
+
+    /**
+     * @brief   Check if a column either by it's index or name is dictionary-encoded.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns true if column is dictionary-encoded.
+     */
+    inline bool IsEncodedColumn(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return _getColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::IsEncodedColumn()").mEncoded;
+    }
+
+    /**
+     * @brief   Get codes of a dictionary-encoded column either by it's index or name.
+     *          Equal cells have equal codes, hence equality tests are integer compares.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns reference to code of each row, which indexes 'GetColumnDictionary()'.
+     */
+    inline const std::vector<uint32_t>& GetColumnCodes(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return _getEncodedColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::GetColumnCodes()").mCodes;
+    }
+
+    /**
+     * @brief   Get dictionary of a dictionary-encoded column either by it's index or name.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns reference to distinct values, indexed by code.
+     */
+    inline const std::vector<std::string>& GetColumnDictionary(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return _getEncodedColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::GetColumnDictionary()").mDictionary;
+    }
+
+    /**
+     * @brief   Get sort-rank of each code of a dictionary-encoded column either by it's index or name.
+     *          'rank[code1] < rank[code2]' iff 'dictionary[code1] < dictionary[code2]', hence
+     *          string sorts become integer compares.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'vector<uint32_t>' of rank, indexed by code.
+     */
+    std::vector<uint32_t> GetColumnCodeRanks(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      const std::vector<std::string>& dictionary =
+        _getEncodedColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::GetColumnCodeRanks()").mDictionary;
+
+      std::vector<uint32_t> sortedCodes(dictionary.size());
+      std::iota(sortedCodes.begin(), sortedCodes.end(), 0);
+      std::sort(sortedCodes.begin(), sortedCodes.end(),
+                [&dictionary](const uint32_t pCode1, const uint32_t pCode2) { return dictionary[pCode1] < dictionary[pCode2]; });
+
+      std::vector<uint32_t> ranks(dictionary.size());
+      for (size_t rank = 0; rank < sortedCodes.size(); ++rank)
+      {
+        ranks[sortedCodes[rank]] = static_cast<uint32_t>(rank);
+      }
+      return ranks;
+    }
+
+    /**
+     * @brief   Get row indexes in order of SortParams. The ordering is same as 'SortDocument', except that the
+     *          sort is stable and rows with equal sort-keys are all kept. For a dictionary-encoded column each
+     *          distinct value is converted and ranked once, and rows are compared by the rank of their code.
+     * @tparam  SPtypes               variadic list of SortParams satisfying concept 'c_SortParams'.
+     * @param   pSortParams           sorting information, one for each ordering-column.
+     * @returns zero-based row indexes in sort order.
+     */
+    template< c_SortParams ... SPtypes >
+    std::vector<size_t> GetSortedRowIdxs(const SPtypes& ... pSortParams) const
+    {
+      const std::tuple<_SortColumn<SPtypes> ...> sortColumns(_SortColumn<SPtypes>(*this, pSortParams) ...);
+
+      std::vector<size_t> rowIdxs(_mRowCount);
+      std::iota(rowIdxs.begin(), rowIdxs.end(), 0);
+      std::stable_sort(rowIdxs.begin(), rowIdxs.end(),
+                       [&sortColumns](const size_t pRowIdx1, const size_t pRowIdx2)
+                       {
+                         int result = 0;
+                         std::apply([&](const auto& ... sortColumn)
+                                    {
+                                      // stops at the first column which differs
+                                      static_cast<void>( ( ((result = sortColumn.compare(pRowIdx1, pRowIdx2)) == 0) && ... ) );
+                                    }, sortColumns);
+                         return result < 0;
+                       });
+      return rowIdxs;
+    }
+
+    /**
+     * @brief   Find code of a value in a dictionary-encoded column either by it's index or name.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pCell                 cell value to search.
+     * @returns code of 'pCell', else 's_NoCode' if value is not present in the column dictionary.
+     */
+    uint32_t FindCode(const c_sizet_or_string auto& pColumnNameIdx, const std::string_view pCell) const
+    {
+      const _Column& column = _getEncodedColumn(GetColumnIdx(pColumnNameIdx), "rapidcsv::ColumnarDocument::FindCode()");
+      const size_t code = column.mDictionaryIdx.find(pCell, column.mDictionary);
+      return (code == _LabelIndex::npos) ? s_NoCode : static_cast<uint32_t>(code);
+    }
+
+    /**
+     * @brief   Get column name
+     * @param   pColumnIdx            zero-based column index.
+     * @returns column name.
+     */
+    inline std::string GetColumnName(const size_t pColumnIdx) const
+    {
+      return _mDocument.GetColumnName(pColumnIdx);
+    }
+
+    /**
+     * @brief   Set column name
+     * @param   pColumnIdx            zero-based column index.
+     * @param   pColumnName           column name.
+     */
+    inline void SetColumnName(const size_t pColumnIdx, const std::string& pColumnName)
+    {
+      _mDocument.SetColumnName(pColumnIdx, pColumnName);
+    }
+
+    /**
+     * @brief   Get column names
+     * @returns vector of column names.
+     */
+    inline std::vector<std::string> GetColumnNames() const
+    {
+      return _mDocument.GetColumnNames();
+    }
+
+    /**
+     * @brief   Get row name
+     * @param   pRowIdx               zero-based column index.
+     * @returns row name.
+     */
+    inline std::string GetRowName(const size_t pRowIdx) const
+    {
+      return _mDocument.GetRowName(pRowIdx);
+    }
+
+    /**
+     * @brief   Set row name
+     * @param   pRowIdx               zero-based row index.
+     * @param   pRowName              row name.
+     */
+    inline void SetRowName(const size_t pRowIdx, const std::string& pRowName)
+    {
+      _mDocument.SetRowName(pRowIdx, pRowName);
+    }
+
+    /**
+     * @brief   Get row names
+     * @returns vector of row names.
+     */
+    inline std::vector<std::string> GetRowNames() const
+    {
+      return _mDocument.GetRowNames();
+    }
+
+  private:
+    // a column of cells, either plain or dictionary-encoded (distinct values + 32-bit code per row).
+    class _Column
+    {
+    public:
+      explicit _Column(const size_t pRowCount = 0)
+        : mEncoded(false)
+        , mCells(pRowCount)
+        , mDictionary()
+        , mDictionaryIdx()
+        , mCodes()
+      {}
+
+      explicit _Column(t_dataColumn&& pCells)
+        : mEncoded(false)
+        , mCells(std::move(pCells))
+        , mDictionary()
+        , mDictionaryIdx()
+        , mCodes()
+      {}
+
+      inline const std::string& operator[](const size_t pRowIdx) const
+      {
+        return mEncoded ? mDictionary[mCodes[pRowIdx]] : mCells[pRowIdx];
+      }
+
+      inline const std::string& at(const size_t pRowIdx) const
+      {
+        return mEncoded ? mDictionary.at(mCodes.at(pRowIdx)) : mCells.at(pRowIdx);
+      }
+
+      inline void set(const size_t pRowIdx, std::string&& pCell)
+      {
+        if (mEncoded)
+        {
+          mCodes[pRowIdx] = encode(pCell);
+        } else {
+          mCells[pRowIdx] = std::move(pCell);
+        }
+      }
+
+      inline void set(const size_t pRowIdx, const std::string& pCell)
+      {
+        if (mEncoded)
+        {
+          mCodes[pRowIdx] = encode(pCell);
+        } else {
+          mCells[pRowIdx] = pCell;
+        }
+      }
+
+      template< typename T_C >
+      inline void setVal(const size_t pRowIdx, const typename converter::t_T2Sconv_c<T_C>::input_type& pVal)
+      {
+        if (mEncoded)
+        {
+          std::string cell;
+          _T2Sdispatch<T_C>(pVal, cell);
+          mCodes[pRowIdx] = encode(cell);
+        } else {
+          _T2Sdispatch<T_C>(pVal, mCells[pRowIdx]);
+        }
+      }
+
+      void resize(const size_t pRowCount)
+      {
+        if (mEncoded)
+        {
+          mCodes.resize(pRowCount, encode(std::string_view()));
+        } else {
+          mCells.resize(pRowCount);
+        }
+      }
+
+      void insert(const size_t pRowIdx)
+      {
+        if (mEncoded)
+        {
+          mCodes.insert(mCodes.begin() + static_cast<ssize_t>(pRowIdx), encode(std::string_view()));
+        } else {
+          mCells.insert(mCells.begin() + static_cast<ssize_t>(pRowIdx), std::string());
+        }
+      }
+
+      void erase(const size_t pRowIdx)
+      {
+        if (mEncoded)
+        {
+          mCodes.erase(mCodes.begin() + static_cast<ssize_t>(pRowIdx));
+        } else {
+          mCells.erase(mCells.begin() + static_cast<ssize_t>(pRowIdx));
+        }
+      }
+
+      // code of 'pCell', which is added to the dictionary if not present.
+      uint32_t encode(const std::string_view pCell)
+      {
+        size_t code = mDictionaryIdx.find(pCell, mDictionary);
+        if (code == _LabelIndex::npos)
+        {
+          code = mDictionary.size();
+          if (code >= s_NoCode)
+          {
+            static const std::string errMsg("rapidcsv::ColumnarDocument::_Column::encode() : number of distinct values exceeds 32-bit code range");
+            throw std::out_of_range(errMsg);
+          }
+          mDictionary.emplace_back(pCell);
+          mDictionaryIdx.insert(code, mDictionary);
+        }
+        return static_cast<uint32_t>(code);
+      }
+
+      void encodeColumn()
+      {
+        if (mEncoded)
+        {
+          return;
+        }
+        mCodes.reserve(mCells.size());
+        for (const std::string& cell : mCells)
+        {
+          mCodes.push_back(encode(cell));
+        }
+        t_dataColumn().swap(mCells);
+        mEncoded = true;
+      }
+
+      void decodeColumn()
+      {
+        if (!mEncoded)
+        {
+          return;
+        }
+        mCells.reserve(mCodes.size());
+        for (const uint32_t code : mCodes)
+        {
+          mCells.push_back(mDictionary[code]);
+        }
+        std::vector<uint32_t>().swap(mCodes);
+        std::vector<std::string>().swap(mDictionary);
+        mDictionaryIdx.clear();
+        mEncoded = false;
+      }
+
+      bool                     mEncoded;
+      t_dataColumn             mCells;          // plain column
+      std::vector<std::string> mDictionary;     // encoded column : distinct values, indexed by code
+      _LabelIndex              mDictionaryIdx;  // encoded column : value -> code
+      std::vector<uint32_t>    mCodes;          // encoded column : code of each row
+    };
+
+    // sort-key of a column for 'GetSortedRowIdxs()' : the rank of each row's code for an encoded column,
+    // else the converted value of each row.
+    template< c_SortParams SP >
+    class _SortColumn
+    {
+    public:
+      _SortColumn(const ColumnarDocument& pDocument, const SP& pSortParams)
+        : _mEncoded(false)
+        , _mRanks()
+        , _mValues()
+      {
+        const _Column& column = pDocument._getColumn(pSortParams.getColumnIndex(), "rapidcsv::ColumnarDocument::GetSortedRowIdxs()");
+        _mEncoded = column.mEncoded;
+        if (_mEncoded)
+        {
+          const std::vector<std::optional<typename SP::return_type>> values =
+            _convertDictionary<typename SP::S2Tconv_type>(column);
+          std::vector<uint32_t> sortedCodes;
+          for (uint32_t code = 0; code < values.size(); ++code)
+          {
+            if (values[code].has_value())
+            {
+              sortedCodes.push_back(code);
+            }
+          }
+          std::sort(sortedCodes.begin(), sortedCodes.end(),
+                    [&values](const uint32_t pCode1, const uint32_t pCode2) { return *values[pCode1] < *values[pCode2]; });
+
+          // equal values, e.g. "1" and "01" converted to int, have equal rank
+          std::vector<uint32_t> codeRanks(values.size(), 0);
+          uint32_t rank = 0;
+          for (size_t idx = 1; idx < sortedCodes.size(); ++idx)
+          {
+            if (*values[sortedCodes[idx - 1]] < *values[sortedCodes[idx]])
+            {
+              ++rank;
+            }
+            codeRanks[sortedCodes[idx]] = rank;
+          }
+
+          _mRanks.reserve(column.mCodes.size());
+          for (const uint32_t code : column.mCodes)
+          {
+            _mRanks.push_back(codeRanks[code]);
+          }
+        } else {
+          _mValues.reserve(column.mCells.size());
+          for (const std::string& cell : column.mCells)
+          {
+            _mValues.push_back(_S2Tdispatch<typename SP::S2Tconv_type>(cell));
+          }
+        }
+      }
+
+      // negative if row 'pRowIdx1' is ordered before row 'pRowIdx2', zero if equal, else positive.
+      inline int compare(const size_t pRowIdx1, const size_t pRowIdx2) const
+      {
+        int result = 0;
+        if (_mEncoded)
+        {
+          result = (_mRanks[pRowIdx1] < _mRanks[pRowIdx2]) ? -1 : ((_mRanks[pRowIdx2] < _mRanks[pRowIdx1]) ? 1 : 0);
+        } else {
+          result = (_mValues[pRowIdx1] < _mValues[pRowIdx2]) ? -1 : ((_mValues[pRowIdx2] < _mValues[pRowIdx1]) ? 1 : 0);
+        }
+        return (SP::sortOrder == e_SortOrder::ASCEND) ? result : -result;
+      }
+
+    private:
+      bool                                    _mEncoded;
+      std::vector<uint32_t>                   _mRanks;    // encoded column : rank of the code of each row
+      std::vector<typename SP::return_type>   _mValues;   // plain column : converted value of each row
+    };
+
+    // converted value of each code of an encoded column, converted once per code. Codes not used by any row,
+    // e.g. a value replaced by 'SetCell()', are left empty, as the cells of a plain column are never converted.
+    template< typename T_C >
+    static std::vector<std::optional<typename converter::t_S2Tconv_c<T_C>::return_type>>
+    _convertDictionary(const _Column& pColumn)
+    {
+      std::vector<std::optional<typename converter::t_S2Tconv_c<T_C>::return_type>> values(pColumn.mDictionary.size());
+      for (const uint32_t code : pColumn.mCodes)
+      {
+        if (!values[code].has_value())
+        {
+          values[code] = _S2Tdispatch<T_C>(pColumn.mDictionary[code]);
+        }
+      }
+      return values;
+    }
+
+    const _Column& _getEncodedColumn(const size_t pColumnIdx, [[maybe_unused]] const std::string& calleeFunction) const
+    {
+      const _Column& column = _getColumn(pColumnIdx, calleeFunction);
+      if (!column.mEncoded)
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::_getEncodedColumn() : column is not dictionary-encoded");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnIdx=" << pColumnIdx << " calleeFunction='" << calleeFunction << "'");
+        throw std::out_of_range(errMsg);
+      }
+      return column;
+    }
+
+    // transpose '_mDocument._mData' into '_mColumns'. '_mDocument' retains labels and file-format details only.
+    void _extractColumns(const std::vector<std::string>& pEncodeColumns)
+    {
+      Document::t_dataTable& rows = _mDocument._mData;
+      size_t columnCount = 0;
+      for (const Document::t_dataRow& row : rows)
+      {
+        columnCount = std::max(columnCount, row.size());
+      }
+
+      _mRowCount = rows.size();
+      _mColumns.assign(columnCount, _Column(_mRowCount));
+      for (size_t rowIdx = 0; rowIdx < _mRowCount; ++rowIdx)
+      {
+        Document::t_dataRow& row = rows[rowIdx];
+        for (size_t columnIdx = 0; columnIdx < row.size(); ++columnIdx)
+        {
+          _mColumns[columnIdx].mCells[rowIdx] = std::move(row[columnIdx]);
+        }
+      }
+      rows.clear();
+      rows.shrink_to_fit();
+
+      for (const std::string& columnName : pEncodeColumns)
+      {
+        EncodeColumn(columnName);
+      }
+    }
+
+    const _Column& _getColumn(const size_t pColumnIdx, [[maybe_unused]] const std::string& calleeFunction) const
+    {
+      if (pColumnIdx >= _mColumns.size())
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::_getColumn() : column not found");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnIdx=" << pColumnIdx << " calleeFunction='" << calleeFunction << "'");
+        throw std::out_of_range(errMsg);
+      }
+      return _mColumns[pColumnIdx];
+    }
+
+    size_t _checkRowIdx(const size_t pRowIdx, [[maybe_unused]] const std::string& calleeFunction) const
+    {
+      if (pRowIdx >= _mRowCount)
+      {
+        static const std::string errMsg("rapidcsv::ColumnarDocument::_checkRowIdx() : row not found");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowIdx=" << pRowIdx << " calleeFunction='" << calleeFunction << "'");
+        throw std::out_of_range(errMsg);
+      }
+      return pRowIdx;
+    }
+
+    void _resizeRows(const size_t pRowCount)
+    {
+      if (pRowCount > _mRowCount)
+      {
+        for (_Column& column : _mColumns)
+        {
+          column.resize(pRowCount);
+        }
+        _mRowCount = pRowCount;
+      }
+    }
+
+    void _resizeColumns(const size_t pColumnCount)
+    {
+      while (_mColumns.size() < pColumnCount)
+      {
+        _mColumns.emplace_back(_mRowCount);
+      }
+    }
+
+    void _insertEmptyRow(const size_t pRowIdx, const size_t pRowSize, const std::string& pRowName,
+                         const std::string& calleeFunction)
+    {
+      std::vector<std::string> rowNames;
+      if (_mDocument._mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT || !pRowName.empty())
+      {
+        rowNames.push_back(pRowName);
+      }
+      _mDocument._checkNewRowNames(pRowIdx, 1, rowNames, calleeFunction);
+
+      _resizeRows(pRowIdx);
+      _resizeColumns(pRowSize);
+      for (_Column& column : _mColumns)
+      {
+        column.insert(pRowIdx);
+      }
+      ++_mRowCount;
+
+      _mDocument._insertRowNames(pRowIdx, rowNames);
+    }
+
+    template< typename ... T_C, size_t ... I >
+    inline std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+    _getRow(const size_t pRowIdx, std::index_sequence<I...>) const
+    {
+      return std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+               { _S2Tdispatch<T_C>(_mColumns[I][pRowIdx]) ... };
+    }
+
+    template< typename ... T_C, size_t ... I >
+    inline void _setRow(const size_t pRowIdx,
+                        const std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>& pRow,
+                        std::index_sequence<I...>)
+    {
+      (_mColumns[I].setVal<T_C>(pRowIdx, std::get<I>(pRow)), ...);
+    }
+
+    Document                  _mDocument;   // holds labels and file-format details, its '_mData' is kept empty
+    std::vector<_Column>      _mColumns;
+    size_t                    _mRowCount;
+  };
+}
@@ -0,0 +1,505 @@
+/*
+ * extsort.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <rapidcsv/view.h>
+#include <rapidcsv/lazy.h>
+
+
+namespace rapidcsv
+{
+  /**
+   * @brief     Datastructure holding parameters controlling an external (out-of-core) sort.
+   */
+  struct ExternalSortParams
+  {
+    /**
+     * @brief   Constructor
+     * @param   pMemoryBudget         approximate number of bytes of row text and sort keys held in memory,
+     *                                both when sorting a run and for the read buffers of the merge.
+     *                                Default: 64 MiB
+     * @param   pTempDir              directory where sorted runs are spilled to.
+     *                                Default: empty, i.e. 'std::filesystem::temp_directory_path()'
+     * @param   pMaxMergeFanIn        maximum number of runs merged at once, i.e. of files open for reading.
+     *                                More runs are merged in passes into intermediate runs. Minimum 2. Default: 128
+     */
+    explicit ExternalSortParams(const size_t pMemoryBudget = 64 * 1024 * 1024,
+                                const std::string& pTempDir = std::string(),
+                                const size_t pMaxMergeFanIn = 128)
+      : mMemoryBudget(pMemoryBudget)
+      , mTempDir(pTempDir)
+      , mMaxMergeFanIn(pMaxMergeFanIn)
+    {}
+
+    /**
+     * @brief   specifies the approximate number of bytes held in memory.
+     */
+    size_t mMemoryBudget;
+
+    /**
+     * @brief   specifies the directory where sorted runs are spilled to.
+     */
+    std::string mTempDir;
+
+    /**
+     * @brief   specifies the maximum number of runs merged at once.
+     */
+    size_t mMaxMergeFanIn;
+  };
+
+  /**
+   * @brief     Reads rows of CSV text from a stream in fixed-size blocks, a row may span blocks.
+   *            Only intended for internal usage.
+   */
+  class _RowReader
+  {
+  public:
+    _RowReader(std::istream& pStream, const _RowTokenizer& pTokenizer, const size_t pBlockSize)
+      : _mStream(pStream)
+      , _mTokenizer(pTokenizer)
+      , _mBlockSize(std::max<size_t>(pBlockSize, 1))
+      , _mBuffer()
+      , _mPos(0)
+      , _mEof(false)
+    {}
+
+    /**
+     * @brief   Skip a UTF-8 byte order mark at start of stream.
+     * @returns true if a byte order mark was skipped.
+     */
+    bool skipUtf8BOM()
+    {
+      while ((_mBuffer.size() < s_Utf8BOM.size()) && !_mEof)
+      {
+        _fill();
+      }
+      if (std::string_view(_mBuffer).starts_with(std::string_view(s_Utf8BOM.data(), s_Utf8BOM.size())))
+      {
+        _mPos = s_Utf8BOM.size();
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * @brief   Read next row.
+     * @param   pRow                  row text excluding the line break, valid until next call.
+     * @param   pIsLastLine           set to true if the row is not terminated by a line break.
+     * @returns false at end of stream.
+     */
+    bool next(std::string_view& pRow, bool& pIsLastLine)
+    {
+      while (true)
+      {
+        const size_t rowEnd = _mTokenizer.findRowEnd(_mBuffer, _mPos);
+        if (rowEnd < _mBuffer.size())
+        {
+          pRow = std::string_view(_mBuffer.data() + _mPos, rowEnd - _mPos);
+          pIsLastLine = false;
+          _mPos = rowEnd + 1;
+          return true;
+        }
+
+        if (_mEof)
+        {
+          if (_mPos < _mBuffer.size())
+          {
+            pRow = std::string_view(_mBuffer.data() + _mPos, _mBuffer.size() - _mPos);
+            pIsLastLine = true;
+            _mPos = _mBuffer.size();
+            return true;
+          }
+          return false;
+        }
+
+        _fill();
+      }
+    }
+
+  private:
+    // drops consumed rows and appends one block from the stream.
+    void _fill()
+    {
+      _mBuffer.erase(0, _mPos);
+      _mPos = 0;
+      const size_t oldSize = _mBuffer.size();
+      _mBuffer.resize(oldSize + _mBlockSize);
+      _mStream.read(_mBuffer.data() + oldSize, static_cast<std::streamsize>(_mBlockSize));
+      const size_t readLength = static_cast<size_t>(_mStream.gcount());
+      _mBuffer.resize(oldSize + readLength);
+      _mEof = (readLength < _mBlockSize);
+    }
+
+    std::istream&         _mStream;
+    const _RowTokenizer&  _mTokenizer;
+    const size_t          _mBlockSize;
+    std::string           _mBuffer;
+    size_t                _mPos;
+    bool                  _mEof;
+  };
+
+  /**
+   * @brief     Class sorting a CSV file, that need not fit in memory, into a sorted CSV file.
+   *            Rows are read as a stream and sorted in runs bounded by the memory budget, using the
+   *            ordering of 'FilterSortDocument'. Runs are spilled to temporary files and k-way merged,
+   *            at most 'ExternalSortParams::mMaxMergeFanIn' runs at once : more runs are first merged in
+   *            passes into intermediate runs, so that open files and read buffers stay bounded.
+   *            The sort is stable, hence rows with equal sort keys keep their input order and none
+   *            are dropped. Rows (and the column-label row) are written to output as read, while comment
+   *            and skipped empty lines are not written.
+   * @tparam    SPtypes                           variadic list of SortParams satisfying concept 'c_SortParams',
+   *                                              one for each column to be sorted.
+   */
+  template<c_SortParams ... SPtypes>
+  class ExternalSort
+  {
+    static_assert(sizeof...(SPtypes) > 0, "rapidcsv::ExternalSort : minimum one sort column is needed");
+
+  public:
+    /**
+     * @brief   Constructor
+     * @param   pExternalSortParams   specifies memory budget and directory for temporary files.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   spArgs                sort parameters, one for each of 'SPtypes'.
+     */
+    explicit ExternalSort(const ExternalSortParams& pExternalSortParams,
+                          const LabelParams& pLabelParams,
+                          const SeparatorParams& pSeparatorParams,
+                          const LineReaderParams& pLineReaderParams,
+                          const SPtypes& ... spArgs)
+      : _mExternalSortParams(pExternalSortParams)
+      , _mLabelParams(pLabelParams)
+      , _mDocument(std::string(), pLabelParams, pSeparatorParams, pLineReaderParams)
+      , _mSortParams(spArgs ...)
+      , _mRunCount(0)
+      , _mMergePassCount(0)
+    {}
+
+    /**
+     * @brief   Sort a CSV file.
+     * @param   pInputPath            path of the CSV-file to be sorted.
+     * @param   pOutputPath           path of the sorted CSV-file to be created.
+     * @returns number of data rows written (excluding label row).
+     */
+    size_t Sort(const std::string& pInputPath, const std::string& pOutputPath)
+    {
+      std::ifstream input;
+      input.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+      input.open(pInputPath, std::ios::binary);
+      input.exceptions(std::ifstream::badbit);    // reading up to end-of-file sets failbit
+
+      std::ofstream output;
+      output.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+      output.open(pOutputPath, std::ios::binary | std::ios::trunc);
+
+      const _RowTokenizer tokenizer(_mDocument);
+      _RowReader reader(input, tokenizer, _s_BlockSize);
+      if (reader.skipUtf8BOM())
+      {
+        output.write(s_Utf8BOM.data(), static_cast<std::streamsize>(s_Utf8BOM.size()));
+      }
+
+      _TempFiles runFiles;
+      std::vector<_RunEntry> entries;
+      std::string runText;
+      size_t runBytes = 0;
+      size_t rowCount = 0;
+      bool headerPending = (_mLabelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT);
+      const bool rowNamesPresent = (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT);
+
+      Document::t_dataRow cells;
+      std::string_view row;
+      bool isLastLine = false;
+      while (reader.next(row, isLastLine))
+      {
+        if (tokenizer.isSkippedEmpty(row, isLastLine))
+        {
+          continue;
+        }
+
+        cells.clear();
+        tokenizer.tokenize(row, cells, std::string_view::npos);
+        if (tokenizer.isSkippedComment(cells))
+        {
+          continue;
+        }
+
+        if (headerPending)
+        {
+          headerPending = false;
+          _writeRow(output, row);
+          continue;
+        }
+
+        if (rowNamesPresent)
+        {
+          cells.erase(cells.begin()); // sort columns are data column indexes
+        }
+        entries.push_back(_RunEntry{ _createSortKey(cells), runText.size(), row.size() });
+        runText.append(row);
+        runBytes += row.size() + sizeof(_RunEntry);
+        ++rowCount;
+
+        if (runBytes >= _mExternalSortParams.mMemoryBudget)
+        {
+          _spillRun(entries, runText, runFiles);
+          runBytes = 0;
+        }
+      }
+
+      if (runFiles.mPaths.empty())
+      {
+        // all rows fit in memory budget
+        _sortRun(entries);
+        for (const _RunEntry& entry : entries)
+        {
+          _writeRow(output, std::string_view(runText.data() + entry.mOffset, entry.mLength));
+        }
+        _mRunCount = entries.empty() ? 0 : 1;
+        _mMergePassCount = 0;
+      } else {
+        if (!entries.empty())
+        {
+          _spillRun(entries, runText, runFiles);
+        }
+        std::vector<_RunEntry>().swap(entries);
+        std::string().swap(runText);
+        _mRunCount = runFiles.mPaths.size();
+        _mergeRuns(runFiles, tokenizer, output);
+      }
+
+      output.flush();
+      return rowCount;
+    }
+
+    /**
+     * @brief   Get number of sorted runs of the last 'Sort()'. One run means no temporary files were used.
+     * @returns run count.
+     */
+    inline size_t GetRunCount() const
+    {
+      return _mRunCount;
+    }
+
+    /**
+     * @brief   Get number of merge passes of the last 'Sort()', including the final pass writing the output.
+     *          Zero means no temporary files were used.
+     * @returns merge pass count.
+     */
+    inline size_t GetMergePassCount() const
+    {
+      return _mMergePassCount;
+    }
+
+  private:
+    using t_sortKey = typename SortKeyFactory<SPtypes ...>::t_sortKey;
+
+    static constexpr size_t _s_BlockSize = 64 * 1024;
+
+    // row text of a run is kept contiguous in one string, entries refer to it by offset.
+    struct _RunEntry
+    {
+      t_sortKey mKey;
+      size_t    mOffset;
+      size_t    mLength;
+    };
+
+    // temporary run files, removed when going out of scope.
+    struct _TempFiles
+    {
+      std::vector<std::filesystem::path> mPaths;
+
+      _TempFiles()
+        : mPaths()
+      {}
+
+      _TempFiles(const _TempFiles&) = delete;
+      _TempFiles& operator=(const _TempFiles&) = delete;
+
+      ~_TempFiles()
+      {
+        for (const std::filesystem::path& path : mPaths)
+        {
+          std::error_code ec;
+          std::filesystem::remove(path, ec);
+        }
+      }
+    };
+
+    inline t_sortKey _createSortKey(const Document::t_dataRow& pRowData) const
+    {
+      return std::apply([&pRowData](const SPtypes& ... spArgs)
+                        { return SortKeyFactory<SPtypes ...>::createSortKey(pRowData, spArgs ...); },
+                        _mSortParams);
+    }
+
+    static inline void _writeRow(std::ostream& pStream, const std::string_view pRow)
+    {
+      pStream.write(pRow.data(), static_cast<std::streamsize>(pRow.size()));
+      pStream.put('\n');
+    }
+
+    static void _sortRun(std::vector<_RunEntry>& pEntries)
+    {
+      const _RowComparator<SPtypes ...> comparator;
+      std::stable_sort(pEntries.begin(), pEntries.end(),
+                       [&comparator](const _RunEntry& lhs, const _RunEntry& rhs)
+                       { return comparator(lhs.mKey, rhs.mKey); });
+    }
+
+    // adds a new temporary run file to 'pRunFiles' and opens it for writing.
+    void _openRun(_TempFiles& pRunFiles, const size_t pMergePass, std::ofstream& pRun) const
+    {
+      const std::filesystem::path tempDir = _mExternalSortParams.mTempDir.empty() ?
+                                              std::filesystem::temp_directory_path() :
+                                              std::filesystem::path(_mExternalSortParams.mTempDir);
+      const std::string runName = "rapidcsv_run_" +
+                                  std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "_" +
+                                  std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_" +
+                                  std::to_string(pMergePass) + "_" +
+                                  std::to_string(pRunFiles.mPaths.size()) + ".csv";
+      pRunFiles.mPaths.push_back(tempDir / runName);
+
+      pRun.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+      pRun.open(pRunFiles.mPaths.back(), std::ios::binary | std::ios::trunc);
+    }
+
+    void _spillRun(std::vector<_RunEntry>& pEntries, std::string& pRunText, _TempFiles& pRunFiles) const
+    {
+      _sortRun(pEntries);
+
+      std::ofstream run;
+      _openRun(pRunFiles, 0, run);
+      for (const _RunEntry& entry : pEntries)
+      {
+        _writeRow(run, std::string_view(pRunText.data() + entry.mOffset, entry.mLength));
+      }
+
+      pEntries.clear();
+      pRunText.clear();
+    }
+
+    // merges sorted runs into 'pOutput'. While there are more runs than the fan-in, each pass merges groups of
+    // consecutive runs into intermediate runs; runs of a pass are removed once merged. Groups of consecutive runs
+    // keep the merge stable.
+    void _mergeRuns(_TempFiles& pRunFiles, const _RowTokenizer& pTokenizer, std::ostream& pOutput)
+    {
+      const size_t fanIn = std::max<size_t>(2, _mExternalSortParams.mMaxMergeFanIn);
+      _mMergePassCount = 0;
+      while (pRunFiles.mPaths.size() > fanIn)
+      {
+        ++_mMergePassCount;
+        _TempFiles mergedFiles;
+        const std::span<const std::filesystem::path> runPaths(pRunFiles.mPaths);
+        for (size_t firstRunIdx = 0; firstRunIdx < runPaths.size(); firstRunIdx += fanIn)
+        {
+          const size_t groupSize = std::min(fanIn, runPaths.size() - firstRunIdx);
+          std::ofstream merged;
+          _openRun(mergedFiles, _mMergePassCount, merged);
+          _mergeRunGroup(runPaths.subspan(firstRunIdx, groupSize), pTokenizer, merged);
+        }
+        std::swap(pRunFiles.mPaths, mergedFiles.mPaths);  // the input runs of this pass are removed with 'mergedFiles'
+      }
+
+      ++_mMergePassCount;
+      _mergeRunGroup(pRunFiles.mPaths, pTokenizer, pOutput);
+    }
+
+    // k-way merge of sorted runs. On equal keys, the row of the earlier run is written first.
+    void _mergeRunGroup(const std::span<const std::filesystem::path> pRunPaths, const _RowTokenizer& pTokenizer,
+                        std::ostream& pOutput) const
+    {
+      const size_t runCount = pRunPaths.size();
+      const size_t blockSize = std::max<size_t>(4096, _mExternalSortParams.mMemoryBudget / (runCount + 1));
+      const bool rowNamesPresent = (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT);
+
+      std::vector<std::ifstream> runStreams(runCount);
+      std::vector<std::unique_ptr<_RowReader>> readers;
+      std::vector<std::string_view> rows(runCount);
+      readers.reserve(runCount);
+      for (size_t runIdx = 0; runIdx < runCount; ++runIdx)
+      {
+        runStreams[runIdx].exceptions(std::ifstream::failbit | std::ifstream::badbit);
+        runStreams[runIdx].open(pRunPaths[runIdx], std::ios::binary);
+        runStreams[runIdx].exceptions(std::ifstream::badbit);
+        readers.push_back(std::make_unique<_RowReader>(runStreams[runIdx], pTokenizer, blockSize));
+      }
+
+      struct _MergeHead
+      {
+        t_sortKey mKey;
+        size_t    mRunIdx;
+      };
+      const _RowComparator<SPtypes ...> comparator;
+      // 'std::priority_queue' pops the greatest, hence 'lhs' is less when it is to be written after 'rhs'.
+      auto writtenAfter = [&comparator](const _MergeHead& lhs, const _MergeHead& rhs)
+      {
+        if (comparator(rhs.mKey, lhs.mKey)) return true;
+        if (comparator(lhs.mKey, rhs.mKey)) return false;
+        return lhs.mRunIdx > rhs.mRunIdx;
+      };
+      std::priority_queue<_MergeHead, std::vector<_MergeHead>, decltype(writtenAfter)> heads(writtenAfter);
+
+      Document::t_dataRow cells;
+      auto pushHead = [&](const size_t pRunIdx)
+      {
+        bool isLastLine = false;
+        if (readers[pRunIdx]->next(rows[pRunIdx], isLastLine))
+        {
+          cells.clear();
+          pTokenizer.tokenize(rows[pRunIdx], cells, std::string_view::npos);
+          if (rowNamesPresent)
+          {
+            cells.erase(cells.begin());
+          }
+          heads.push(_MergeHead{ _createSortKey(cells), pRunIdx });
+        }
+      };
+
+      for (size_t runIdx = 0; runIdx < runCount; ++runIdx)
+      {
+        pushHead(runIdx);
+      }
+      while (!heads.empty())
+      {
+        const size_t runIdx = heads.top().mRunIdx;
+        heads.pop();
+        _writeRow(pOutput, rows[runIdx]);
+        pushHead(runIdx);
+      }
+    }
+
+    const ExternalSortParams      _mExternalSortParams;
+    const LabelParams             _mLabelParams;
+    const Document                _mDocument;     // holds file-format details only, its '_mData' is kept empty
+    const std::tuple<SPtypes ...> _mSortParams;
+    size_t                        _mRunCount;
+    size_t                        _mMergePassCount;
+  };
+}
@@ -0,0 +1,896 @@
+/*
+ * filterexpr.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <rapidcsv/view.h>
+#include <rapidcsv/columnar.h>
+
+
+namespace rapidcsv
+{
+  enum e_CompareOp
+  {
+    EQUAL = 0,
+    NOT_EQUAL,
+    LESS,
+    LESS_EQUAL,
+    GREATER,
+    GREATER_EQUAL
+  };
+
+  /**
+   * @brief     Scratch buffers of the nodes of a filter plan, for one evaluation. Each node has its own slot,
+   *            created on the first block and reused by the following blocks. Kept apart from the plan,
+   *            hence a plan can be evaluated by several threads at once. Only intended for internal usage.
+   */
+  class _FilterPlanScratch
+  {
+  public:
+    explicit _FilterPlanScratch(const size_t pSlotCount)
+      : _mSlots(pSlotCount)
+    {}
+
+    /**
+     * @brief   Get the buffers of a node, creating them on first use.
+     * @tparam  T_BUFFERS             buffers type of the node.
+     * @param   pSlot                 slot of the node, as assigned by '_FilterPlanNode::assignScratchSlots()'.
+     * @param   pBlockSize            number of rows of the first block, for the initial capacity.
+     * @returns buffers of the node.
+     */
+    template< typename T_BUFFERS >
+    T_BUFFERS& get(const size_t pSlot, const size_t pBlockSize)
+    {
+      std::shared_ptr<void>& slot = _mSlots[pSlot];
+      if (!slot)
+      {
+        slot = std::make_shared<T_BUFFERS>(pBlockSize);
+      }
+      return *static_cast<T_BUFFERS*>(slot.get());
+    }
+
+  private:
+    std::vector<std::shared_ptr<void>> _mSlots;
+  };
+
+  /**
+   * @brief     Node of a compiled filter plan, i.e. with document, column-index and conversion resolved.
+   *            Only intended for internal usage.
+   */
+  class _FilterPlanNode
+  {
+  public:
+    virtual ~_FilterPlanNode() = default;
+
+    /**
+     * @brief   Assign a scratch slot to this node and its operands, once when the plan is created.
+     * @param   pNextSlot             first free slot.
+     * @returns first free slot after this node and its operands.
+     */
+    virtual size_t assignScratchSlots(const size_t pNextSlot) = 0;
+
+    /**
+     * @brief   Evaluate the selected rows of a block, gathered by row index.
+     * @param   pRowIdxs              zero-based row indexes of the block, same size as 'pMask'.
+     * @param   pSelected             1 for rows to be evaluated, same size as 'pMask'. Cells of the
+     *                                other rows are not converted.
+     * @param   pMask                 set to 1 for selected rows where the expression is true, else 0.
+     * @param   pScratch              scratch buffers of the evaluation, reused across blocks.
+     */
+    virtual void evaluate(std::span<const size_t> pRowIdxs, std::span<const uint8_t> pSelected,
+                          std::span<uint8_t> pMask, _FilterPlanScratch& pScratch) const = 0;
+  };
+
+  /**
+   * @brief     Scratch buffers of a typed leaf : converted cells of the selected rows of a block, and their
+   *            positions in the block. Only intended for internal usage.
+   */
+  template< typename T_VALUE >
+  struct _FilterLeafBuffers
+  {
+    explicit _FilterLeafBuffers(const size_t pBlockSize)
+      : mValues()
+      , mValueIdxs()
+    {
+      mValues.reserve(pBlockSize);
+      mValueIdxs.reserve(pBlockSize);
+    }
+
+    std::vector<T_VALUE> mValues;
+    std::vector<size_t>  mValueIdxs;
+  };
+
+  /**
+   * @brief     Node of a filter expression, with column referred by name or index.
+   *            Only intended for internal usage.
+   */
+  class _FilterExprNode
+  {
+  public:
+    virtual ~_FilterExprNode() = default;
+
+    /**
+     * @brief   Resolve column names and create the plan node.
+     * @param   pDocument             Document the plan is evaluated on.
+     * @returns plan node.
+     */
+    virtual std::unique_ptr<_FilterPlanNode> compile(const Document& pDocument) const = 0;
+
+    /**
+     * @brief   Resolve column names and create the plan node.
+     * @param   pDocument             ColumnarDocument the plan is evaluated on.
+     * @returns plan node.
+     */
+    virtual std::unique_ptr<_FilterPlanNode> compile(const ColumnarDocument& pDocument) const = 0;
+  };
+
+  /**
+   * @brief     Typed leaf of a compiled filter plan. Cells of the selected rows of a block are converted
+   *            into a contiguous buffer first, then the predicate runs over the buffer.
+   *            Only intended for internal usage.
+   */
+  template< typename T_C, typename PREDICATE >
+  class _FilterPlanLeaf : public _FilterPlanNode
+  {
+  public:
+    using return_type = typename converter::t_S2Tconv_c<T_C>::return_type;
+
+    _FilterPlanLeaf(const Document& pDocument, const size_t pColumnIdx, PREDICATE&& pPredicate)
+      : _mDocument(pDocument)
+      , _mColumnIdx(pColumnIdx)
+      , _mPredicate(std::move(pPredicate))
+      , _mScratchSlot(0)
+    {}
+
+    size_t assignScratchSlots(const size_t pNextSlot) override
+    {
+      _mScratchSlot = pNextSlot;
+      return pNextSlot + 1;
+    }
+
+    void evaluate(std::span<const size_t> pRowIdxs, std::span<const uint8_t> pSelected,
+                  std::span<uint8_t> pMask, _FilterPlanScratch& pScratch) const override
+    {
+      _FilterLeafBuffers<return_type>& buffers = pScratch.get< _FilterLeafBuffers<return_type> >(_mScratchSlot, pMask.size());
+      std::vector<return_type>& values = buffers.mValues;
+      std::vector<size_t>& valueIdxs = buffers.mValueIdxs;
+      values.clear();
+      valueIdxs.clear();
+      for (size_t idx = 0; idx < pMask.size(); ++idx)
+      {
+        pMask[idx] = 0;
+        if (pSelected[idx] == 0)
+        {
+          continue;
+        }
+
+        const size_t rowIdx = pRowIdxs[idx];
+        const Document::t_dataRow& row = _mDocument._getDataRow(rowIdx);
+        if (_mColumnIdx >= row.size())
+        {
+          static const std::string errMsg("rapidcsv::FilterPlan::Evaluate() : requested column index is more than row.size()");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : columnIdx=" << _mColumnIdx << " , rowIdx=" << rowIdx << " , row.size()=" << row.size());
+          throw std::out_of_range(errMsg);
+        }
+        values.push_back(_S2Tdispatch<T_C>(row[_mColumnIdx]));
+        valueIdxs.push_back(idx);
+      }
+
+      for (size_t valueIdx = 0; valueIdx < values.size(); ++valueIdx)
+      {
+        pMask[valueIdxs[valueIdx]] = _mPredicate(values[valueIdx]) ? 1 : 0;
+      }
+    }
+
+  private:
+    const Document& _mDocument;
+    const size_t    _mColumnIdx;
+    const PREDICATE _mPredicate;
+    size_t          _mScratchSlot;
+  };
+
+  /**
+   * @brief     Typed leaf of a filter plan compiled for a ColumnarDocument. On a dictionary-encoded column
+   *            the predicate is evaluated once per distinct value when compiled, and rows are tested by code.
+   *            Else cells of the selected rows are converted into a contiguous buffer, as by '_FilterPlanLeaf'.
+   *            Only intended for internal usage.
+   */
+  template< typename T_C, typename PREDICATE >
+  class _ColumnarFilterPlanLeaf : public _FilterPlanNode
+  {
+  public:
+    using return_type = typename converter::t_S2Tconv_c<T_C>::return_type;
+
+    _ColumnarFilterPlanLeaf(const ColumnarDocument& pDocument, const size_t pColumnIdx, PREDICATE&& pPredicate)
+      : _mDocument(pDocument)
+      , _mColumnIdx(pColumnIdx)
+      , _mPredicate(std::move(pPredicate))
+      , _mEncoded(pDocument.IsEncodedColumn(pColumnIdx))
+      , _mCodeResults()
+      , _mCodeErrors()
+      , _mScratchSlot(0)
+    {
+      if (_mEncoded)
+      {
+        // a value failing conversion is reported only when a selected row has it, same as for plain cells
+        const std::vector<std::string>& dictionary = pDocument.GetColumnDictionary(pColumnIdx);
+        _mCodeResults.resize(dictionary.size());
+        for (size_t code = 0; code < dictionary.size(); ++code)
+        {
+          try
+          {
+            _mCodeResults[code] = _mPredicate(_S2Tdispatch<T_C>(dictionary[code])) ? 1 : 0;
+          } catch (...) {
+            _mCodeResults[code] = s_ConvertError;
+            _mCodeErrors.resize(dictionary.size());
+            _mCodeErrors[code] = std::current_exception();
+          }
+        }
+      }
+    }
+
+    size_t assignScratchSlots(const size_t pNextSlot) override
+    {
+      _mScratchSlot = pNextSlot;
+      return pNextSlot + 1;
+    }
+
+    void evaluate(std::span<const size_t> pRowIdxs, std::span<const uint8_t> pSelected,
+                  std::span<uint8_t> pMask, _FilterPlanScratch& pScratch) const override
+    {
+      if (_mDocument.IsEncodedColumn(_mColumnIdx) != _mEncoded)
+      {
+        static const std::string errMsg("rapidcsv::FilterPlan::Evaluate() : column was encoded or decoded after the plan was compiled");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : columnIdx=" << _mColumnIdx);
+        throw std::out_of_range(errMsg);
+      }
+
+      if (_mEncoded)
+      {
+        const std::vector<uint32_t>& codes = _mDocument.GetColumnCodes(_mColumnIdx);
+        for (size_t idx = 0; idx < pMask.size(); ++idx)
+        {
+          pMask[idx] = 0;
+          if (pSelected[idx] == 0)
+          {
+            continue;
+          }
+
+          const uint32_t code = codes[pRowIdxs[idx]];
+          if (code < _mCodeResults.size())
+          {
+            if (_mCodeResults[code] == s_ConvertError)
+            {
+              std::rethrow_exception(_mCodeErrors[code]);
+            }
+            pMask[idx] = _mCodeResults[code];
+          } else {
+            // value added to the dictionary after the plan was compiled
+            pMask[idx] = _mPredicate(_S2Tdispatch<T_C>(_mDocument.GetColumnDictionary(_mColumnIdx)[code])) ? 1 : 0;
+          }
+        }
+        return;
+      }
+
+      const ColumnarDocument::t_dataColumn& cells = _mDocument.GetColumn_VecStr(_mColumnIdx);
+      _FilterLeafBuffers<return_type>& buffers = pScratch.get< _FilterLeafBuffers<return_type> >(_mScratchSlot, pMask.size());
+      std::vector<return_type>& values = buffers.mValues;
+      std::vector<size_t>& valueIdxs = buffers.mValueIdxs;
+      values.clear();
+      valueIdxs.clear();
+      for (size_t idx = 0; idx < pMask.size(); ++idx)
+      {
+        pMask[idx] = 0;
+        if (pSelected[idx] != 0)
+        {
+          values.push_back(_S2Tdispatch<T_C>(cells[pRowIdxs[idx]]));
+          valueIdxs.push_back(idx);
+        }
+      }
+
+      for (size_t valueIdx = 0; valueIdx < values.size(); ++valueIdx)
+      {
+        pMask[valueIdxs[valueIdx]] = _mPredicate(values[valueIdx]) ? 1 : 0;
+      }
+    }
+
+  private:
+    static constexpr uint8_t s_ConvertError = 2;
+
+    const ColumnarDocument&          _mDocument;
+    const size_t                     _mColumnIdx;
+    const PREDICATE                  _mPredicate;
+    const bool                       _mEncoded;
+    std::vector<uint8_t>             _mCodeResults;   // encoded column : predicate result of each code
+    std::vector<std::exception_ptr>  _mCodeErrors;    // encoded column : conversion error of each code, if any
+    size_t                           _mScratchSlot;
+  };
+
+  /**
+   * @brief     Typed leaf of a filter expression. Only intended for internal usage.
+   */
+  template< typename T_C, typename PREDICATE >
+  class _FilterExprLeaf : public _FilterExprNode
+  {
+  public:
+    _FilterExprLeaf(const _ColumnRef& pColumn, PREDICATE&& pPredicate)
+      : _mColumn(pColumn)
+      , _mPredicate(std::move(pPredicate))
+    {}
+
+    std::unique_ptr<_FilterPlanNode> compile(const Document& pDocument) const override
+    {
+      return std::make_unique< _FilterPlanLeaf<T_C, PREDICATE> >(pDocument, _mColumn.resolve(pDocument),
+                                                                 PREDICATE(_mPredicate));
+    }
+
+    std::unique_ptr<_FilterPlanNode> compile(const ColumnarDocument& pDocument) const override
+    {
+      return std::make_unique< _ColumnarFilterPlanLeaf<T_C, PREDICATE> >(pDocument, _mColumn.resolve(pDocument),
+                                                                         PREDICATE(_mPredicate));
+    }
+
+  private:
+    const _ColumnRef _mColumn;
+    const PREDICATE  _mPredicate;
+  };
+
+  /**
+   * @brief     AND / OR / NOT of compiled plan nodes. Only intended for internal usage.
+   */
+  class _FilterPlanLogical : public _FilterPlanNode
+  {
+  public:
+    enum e_Logical { AND = 0, OR, NOT };
+
+    _FilterPlanLogical(const e_Logical pLogical, std::unique_ptr<_FilterPlanNode>&& pLhs,
+                       std::unique_ptr<_FilterPlanNode>&& pRhs)
+      : _mLogical(pLogical)
+      , _mLhs(std::move(pLhs))
+      , _mRhs(std::move(pRhs))
+      , _mScratchSlot(0)
+    {}
+
+    size_t assignScratchSlots(const size_t pNextSlot) override
+    {
+      _mScratchSlot = pNextSlot;
+      const size_t nextSlot = _mLhs->assignScratchSlots(pNextSlot + 1);
+      return _mRhs ? _mRhs->assignScratchSlots(nextSlot) : nextSlot;
+    }
+
+    void evaluate(std::span<const size_t> pRowIdxs, std::span<const uint8_t> pSelected,
+                  std::span<uint8_t> pMask, _FilterPlanScratch& pScratch) const override
+    {
+      _mLhs->evaluate(pRowIdxs, pSelected, pMask, pScratch);
+      if (_mLogical == NOT)
+      {
+        for (size_t idx = 0; idx < pMask.size(); ++idx)
+        {
+          pMask[idx] = pSelected[idx] & (pMask[idx] ^ 1);
+        }
+        return;
+      }
+
+      // the right operand is evaluated only on rows the left operand leaves undecided,
+      // i.e. true for AND and false for OR, hence the result never depends on the block boundaries
+      const uint8_t undecided = (_mLogical == AND) ? 1 : 0;
+      _Buffers& buffers = pScratch.get<_Buffers>(_mScratchSlot, pMask.size());
+      const std::span<uint8_t> rhsSelected(buffers.mRhsSelected.data(), pMask.size());
+      bool hasUndecided = false;
+      for (size_t idx = 0; idx < pMask.size(); ++idx)
+      {
+        rhsSelected[idx] = pSelected[idx] & static_cast<uint8_t>(pMask[idx] == undecided);
+        hasUndecided = hasUndecided || (rhsSelected[idx] != 0);
+      }
+      if (!hasUndecided)
+      {
+        return;
+      }
+
+      const std::span<uint8_t> rhsMask(buffers.mRhsMask.data(), pMask.size());
+      _mRhs->evaluate(pRowIdxs, rhsSelected, rhsMask, pScratch);
+      for (size_t idx = 0; idx < pMask.size(); ++idx)
+      {
+        if (rhsSelected[idx] != 0)
+        {
+          pMask[idx] = rhsMask[idx];
+        }
+      }
+    }
+
+  private:
+    // selection and result of the right operand, for a block of at most the first block's size.
+    struct _Buffers
+    {
+      explicit _Buffers(const size_t pBlockSize)
+        : mRhsSelected(pBlockSize)
+        , mRhsMask(pBlockSize)
+      {}
+
+      std::vector<uint8_t> mRhsSelected;
+      std::vector<uint8_t> mRhsMask;
+    };
+
+    const e_Logical                        _mLogical;
+    const std::unique_ptr<_FilterPlanNode> _mLhs;
+    const std::unique_ptr<_FilterPlanNode> _mRhs;
+    size_t                                 _mScratchSlot;
+  };
+
+  /**
+   * @brief     AND / OR / NOT of filter expressions. Only intended for internal usage.
+   */
+  class _FilterExprLogical : public _FilterExprNode
+  {
+  public:
+    _FilterExprLogical(const _FilterPlanLogical::e_Logical pLogical, std::shared_ptr<const _FilterExprNode> pLhs,
+                       std::shared_ptr<const _FilterExprNode> pRhs)
+      : _mLogical(pLogical)
+      , _mLhs(std::move(pLhs))
+      , _mRhs(std::move(pRhs))
+    {}
+
+    std::unique_ptr<_FilterPlanNode> compile(const Document& pDocument) const override
+    {
+      return std::make_unique<_FilterPlanLogical>(_mLogical, _mLhs->compile(pDocument),
+                                                  _mRhs ? _mRhs->compile(pDocument) : nullptr);
+    }
+
+    std::unique_ptr<_FilterPlanNode> compile(const ColumnarDocument& pDocument) const override
+    {
+      return std::make_unique<_FilterPlanLogical>(_mLogical, _mLhs->compile(pDocument),
+                                                  _mRhs ? _mRhs->compile(pDocument) : nullptr);
+    }
+
+  private:
+    const _FilterPlanLogical::e_Logical          _mLogical;
+    const std::shared_ptr<const _FilterExprNode> _mLhs;
+    const std::shared_ptr<const _FilterExprNode> _mRhs;
+  };
+
+  class FilterPlan;
+
+  /**
+   * @brief     Class representing a filter expression built at runtime, from column comparisons,
+   *            IN-lists and ranges combined with AND ('&' or 'And()'), OR ('|' or 'Or()') and NOT ('!').
+   *            Values are of the converted type of the column, same as 'Document::GetCell<T_C>()'.
+   *            Expressions are immutable and cheap to copy, sub-expressions are shared.
+   */
+  class FilterExpr
+  {
+  public:
+    /**
+     * @brief   Comparison of a column with a value.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pOp                   comparison operator, cell value is the left operand.
+     * @param   pValue                value to be compared with.
+     * @returns filter expression.
+     */
+    template< typename T_C >
+    static FilterExpr Compare(const c_sizet_or_string auto& pColumnNameIdx, const e_CompareOp pOp,
+                              const typename converter::t_S2Tconv_c<T_C>::return_type& pValue)
+    {
+      using t_value = typename converter::t_S2Tconv_c<T_C>::return_type;
+      const _ColumnRef column(pColumnNameIdx);
+      switch (pOp)
+      {
+        case e_CompareOp::EQUAL:
+          return _leaf<T_C>(column, [pValue](const t_value& val) { return val == pValue; });
+        case e_CompareOp::NOT_EQUAL:
+          return _leaf<T_C>(column, [pValue](const t_value& val) { return val != pValue; });
+        case e_CompareOp::LESS:
+          return _leaf<T_C>(column, [pValue](const t_value& val) { return val < pValue; });
+        case e_CompareOp::LESS_EQUAL:
+          return _leaf<T_C>(column, [pValue](const t_value& val) { return val <= pValue; });
+        case e_CompareOp::GREATER:
+          return _leaf<T_C>(column, [pValue](const t_value& val) { return val > pValue; });
+        case e_CompareOp::GREATER_EQUAL:
+          return _leaf<T_C>(column, [pValue](const t_value& val) { return val >= pValue; });
+        default:
+        {
+          static const std::string errMsg("rapidcsv::FilterExpr::Compare() : unknown comparison operator");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : pOp=" << static_cast<int>(pOp));
+          throw std::invalid_argument(errMsg);
+        }
+      }
+    }
+
+    /**
+     * @brief   Membership of a column value in a list of values.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pValues               list of values.
+     * @returns filter expression.
+     */
+    template< typename T_C >
+    static FilterExpr In(const c_sizet_or_string auto& pColumnNameIdx,
+                         std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> pValues)
+    {
+      using t_value = typename converter::t_S2Tconv_c<T_C>::return_type;
+      std::sort(pValues.begin(), pValues.end());
+      pValues.erase(std::unique(pValues.begin(), pValues.end()), pValues.end());
+      return _leaf<T_C>(_ColumnRef(pColumnNameIdx),
+                        [values = std::move(pValues)](const t_value& val)
+                        { return std::binary_search(values.begin(), values.end(), val); });
+    }
+
+    /**
+     * @brief   Column value within an inclusive range, i.e. 'pLow <= value <= pHigh'.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pLow                  lower bound.
+     * @param   pHigh                 upper bound.
+     * @returns filter expression.
+     */
+    template< typename T_C >
+    static FilterExpr Range(const c_sizet_or_string auto& pColumnNameIdx,
+                            const typename converter::t_S2Tconv_c<T_C>::return_type& pLow,
+                            const typename converter::t_S2Tconv_c<T_C>::return_type& pHigh)
+    {
+      using t_value = typename converter::t_S2Tconv_c<T_C>::return_type;
+      return _leaf<T_C>(_ColumnRef(pColumnNameIdx),
+                        [pLow, pHigh](const t_value& val) { return (pLow <= val) && (val <= pHigh); });
+    }
+
+    /**
+     * @brief   Logical AND, the right operand is only evaluated for rows where this expression is true.
+     * @param   pRhs                  right operand.
+     * @returns filter expression.
+     */
+    FilterExpr And(const FilterExpr& pRhs) const
+    {
+      return FilterExpr(std::make_shared<_FilterExprLogical>(_FilterPlanLogical::AND, _mNode, pRhs._mNode));
+    }
+
+    /**
+     * @brief   Logical OR, the right operand is only evaluated for rows where this expression is false.
+     * @param   pRhs                  right operand.
+     * @returns filter expression.
+     */
+    FilterExpr Or(const FilterExpr& pRhs) const
+    {
+      return FilterExpr(std::make_shared<_FilterExprLogical>(_FilterPlanLogical::OR, _mNode, pRhs._mNode));
+    }
+
+    /**
+     * @brief   Logical AND, same as 'pLhs.And(pRhs)'. Binds tighter than '|', as '&&' does than '||'.
+     */
+    friend FilterExpr operator&(const FilterExpr& pLhs, const FilterExpr& pRhs)
+    {
+      return pLhs.And(pRhs);
+    }
+
+    /**
+     * @brief   Logical OR, same as 'pLhs.Or(pRhs)'.
+     */
+    friend FilterExpr operator|(const FilterExpr& pLhs, const FilterExpr& pRhs)
+    {
+      return pLhs.Or(pRhs);
+    }
+
+    /**
+     * @brief   Logical NOT.
+     */
+    friend FilterExpr operator!(const FilterExpr& pExpr)
+    {
+      return FilterExpr(std::make_shared<_FilterExprLogical>(_FilterPlanLogical::NOT, pExpr._mNode, nullptr));
+    }
+
+    /**
+     * @brief   Compile the expression for a Document, resolving column names to indexes.
+     * @param   pDocument             Document the plan is evaluated on.
+     * @returns filter plan, valid as long as the Document's columns are not inserted/removed.
+     */
+    FilterPlan Compile(const Document& pDocument) const;
+
+    /**
+     * @brief   Compile the expression for a ColumnarDocument, resolving column names to indexes. On a
+     *          dictionary-encoded column, each comparison, IN-list or range is evaluated once per distinct
+     *          value, and rows are tested by their code.
+     * @param   pDocument             ColumnarDocument the plan is evaluated on.
+     * @returns filter plan, valid as long as the Document's columns are not inserted/removed, encoded or decoded.
+     */
+    FilterPlan Compile(const ColumnarDocument& pDocument) const;
+
+  private:
+    explicit FilterExpr(std::shared_ptr<const _FilterExprNode> pNode)
+      : _mNode(std::move(pNode))
+    {}
+
+    template< typename T_C, typename PREDICATE >
+    static FilterExpr _leaf(const _ColumnRef& pColumn, PREDICATE&& pPredicate)
+    {
+      return FilterExpr(std::make_shared< _FilterExprLeaf<T_C, std::decay_t<PREDICATE>> >(pColumn, std::forward<PREDICATE>(pPredicate)));
+    }
+
+    std::shared_ptr<const _FilterExprNode> _mNode;
+  };
+
+  /**
+   * @brief     Class representing a filter expression compiled for a Document or ColumnarDocument, i.e. with
+   *            column-indexes and conversion functions resolved once. Rows are evaluated in blocks, converting the cells
+   *            of a column for the whole block before comparing. Rows may be a range of the Document, or
+   *            gathered by row index, e.g. the rows of a view. The buffers of the plan nodes are allocated once
+   *            per evaluation and reused by all its blocks.
+   */
+  class FilterPlan
+  {
+  public:
+    /**
+     * @brief   number of rows evaluated per block.
+     */
+    static constexpr size_t s_BlockSize = 1024;
+
+    FilterPlan(const FilterPlan&) = default;
+    FilterPlan& operator=(const FilterPlan&) = default;
+
+    /**
+     * @brief   Evaluate a range of rows.
+     * @param   pBeginRowIdx          zero-based row index of first row.
+     * @param   pMask                 set to 1 for rows where the expression is true, else 0.
+     *                                Its size is the number of rows evaluated.
+     */
+    void Evaluate(const size_t pBeginRowIdx, std::span<uint8_t> pMask) const
+    {
+      if ((pBeginRowIdx + pMask.size()) > _getRowCount())
+      {
+        static const std::string errMsg("rapidcsv::FilterPlan::Evaluate() : row range exceeds number of data rows");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pBeginRowIdx=" << pBeginRowIdx << " , mask size=" << pMask.size()
+                                  << " , number of data rows=" << _getRowCount());
+        throw std::out_of_range(errMsg);
+      }
+
+      _Blocks blocks(pMask.size(), _mScratchSlotCount);
+      for (size_t offset = 0; offset < pMask.size(); offset += s_BlockSize)
+      {
+        const size_t blockSize = std::min(s_BlockSize, pMask.size() - offset);
+        _evaluateBlock(blocks.rowRange(pBeginRowIdx + offset, blockSize), blocks, pMask.subspan(offset, blockSize));
+      }
+    }
+
+    /**
+     * @brief   Evaluate rows gathered by row index, e.g. the rows of a view.
+     * @param   pRowIdxs              zero-based row indexes of the rows to be evaluated, in any order.
+     * @param   pMask                 set to 1 for rows where the expression is true, else 0.
+     *                                Same size as 'pRowIdxs'.
+     */
+    void Evaluate(std::span<const size_t> pRowIdxs, std::span<uint8_t> pMask) const
+    {
+      _checkRowIdxs(pRowIdxs, pMask.size());
+
+      _Blocks blocks(pMask.size(), _mScratchSlotCount);
+      for (size_t offset = 0; offset < pMask.size(); offset += s_BlockSize)
+      {
+        const size_t blockSize = std::min(s_BlockSize, pMask.size() - offset);
+        _evaluateBlock(pRowIdxs.subspan(offset, blockSize), blocks, pMask.subspan(offset, blockSize));
+      }
+    }
+
+    /**
+     * @brief   Evaluate a single row.
+     * @param   pRowIdx               zero-based row index.
+     * @returns true if the expression is true for the row.
+     */
+    bool Evaluate(const size_t pRowIdx) const
+    {
+      uint8_t flag = 0;
+      Evaluate(pRowIdx, std::span<uint8_t>(&flag, 1));
+      return flag != 0;
+    }
+
+    /**
+     * @brief   Evaluate all rows of the Document.
+     * @returns zero-based indexes of rows where the expression is true, in document order.
+     */
+    std::vector<size_t> Select() const
+    {
+      std::vector<size_t> rowIdxs;
+      std::vector<uint8_t> mask;
+      _Blocks blocks(_getRowCount(), _mScratchSlotCount);
+      for (size_t beginRowIdx = 0; beginRowIdx < _getRowCount(); beginRowIdx += s_BlockSize)
+      {
+        mask.resize(std::min(s_BlockSize, _getRowCount() - beginRowIdx));
+        const std::span<const size_t> blockRowIdxs = blocks.rowRange(beginRowIdx, mask.size());
+        _evaluateBlock(blockRowIdxs, blocks, mask);
+        _appendSelected(blockRowIdxs, mask, rowIdxs);
+      }
+      return rowIdxs;
+    }
+
+    /**
+     * @brief   Evaluate rows gathered by row index, e.g. the rows of a view.
+     * @param   pRowIdxs              zero-based row indexes of the rows to be evaluated, in any order.
+     * @returns row indexes of 'pRowIdxs' where the expression is true, in order of 'pRowIdxs'.
+     */
+    std::vector<size_t> Select(std::span<const size_t> pRowIdxs) const
+    {
+      _checkRowIdxs(pRowIdxs, pRowIdxs.size());
+
+      std::vector<size_t> rowIdxs;
+      std::vector<uint8_t> mask;
+      _Blocks blocks(pRowIdxs.size(), _mScratchSlotCount);
+      for (size_t offset = 0; offset < pRowIdxs.size(); offset += s_BlockSize)
+      {
+        mask.resize(std::min(s_BlockSize, pRowIdxs.size() - offset));
+        const std::span<const size_t> blockRowIdxs = pRowIdxs.subspan(offset, mask.size());
+        _evaluateBlock(blockRowIdxs, blocks, mask);
+        _appendSelected(blockRowIdxs, mask, rowIdxs);
+      }
+      return rowIdxs;
+    }
+
+  private:
+    friend class FilterExpr;
+
+    // buffers reused by the blocks of one evaluation : all rows selected, row indexes of a range of rows,
+    // and the scratch buffers of the plan nodes.
+    struct _Blocks
+    {
+      _Blocks(const size_t pRowCount, const size_t pScratchSlotCount)
+        : mSelected(std::min(s_BlockSize, pRowCount), 1)
+        , mRowIdxs()
+        , mScratch(pScratchSlotCount)
+      {}
+
+      std::span<const size_t> rowRange(const size_t pBeginRowIdx, const size_t pCount)
+      {
+        mRowIdxs.resize(pCount);
+        std::iota(mRowIdxs.begin(), mRowIdxs.end(), pBeginRowIdx);
+        return mRowIdxs;
+      }
+
+      const std::vector<uint8_t> mSelected;
+      std::vector<size_t>        mRowIdxs;
+      _FilterPlanScratch         mScratch;
+    };
+
+    inline void _evaluateBlock(std::span<const size_t> pRowIdxs, _Blocks& pBlocks, std::span<uint8_t> pMask) const
+    {
+      _mRoot->evaluate(pRowIdxs,
+                       std::span<const uint8_t>(pBlocks.mSelected.data(), pMask.size()), pMask, pBlocks.mScratch);
+    }
+
+    static inline void _appendSelected(std::span<const size_t> pRowIdxs, std::span<const uint8_t> pMask,
+                                       std::vector<size_t>& pSelectedRowIdxs)
+    {
+      for (size_t idx = 0; idx < pMask.size(); ++idx)
+      {
+        if (pMask[idx] != 0)
+        {
+          pSelectedRowIdxs.push_back(pRowIdxs[idx]);
+        }
+      }
+    }
+
+    void _checkRowIdxs(std::span<const size_t> pRowIdxs, const size_t pMaskSize) const
+    {
+      if (pRowIdxs.size() != pMaskSize)
+      {
+        static const std::string errMsg("rapidcsv::FilterPlan::Evaluate() : mask size differs from number of row indexes");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : row indexes=" << pRowIdxs.size() << " , mask size=" << pMaskSize);
+        throw std::out_of_range(errMsg);
+      }
+      for (const size_t rowIdx : pRowIdxs)
+      {
+        if (rowIdx >= _getRowCount())
+        {
+          static const std::string errMsg("rapidcsv::FilterPlan::Evaluate() : row index exceeds number of data rows");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : rowIdx=" << rowIdx << " , number of data rows=" << _getRowCount());
+          throw std::out_of_range(errMsg);
+        }
+      }
+    }
+
+    inline size_t _getRowCount() const
+    {
+      return (_mDocument != nullptr) ? _mDocument->_getDataRowCount() : _mColumnarDocument->GetRowCount();
+    }
+
+    FilterPlan(const Document& pDocument, std::unique_ptr<_FilterPlanNode>&& pRoot)
+      : _mDocument(&pDocument)
+      , _mColumnarDocument(nullptr)
+      , _mScratchSlotCount(pRoot->assignScratchSlots(0))
+      , _mRoot(std::move(pRoot))
+    {}
+
+    FilterPlan(const ColumnarDocument& pDocument, std::unique_ptr<_FilterPlanNode>&& pRoot)
+      : _mDocument(nullptr)
+      , _mColumnarDocument(&pDocument)
+      , _mScratchSlotCount(pRoot->assignScratchSlots(0))
+      , _mRoot(std::move(pRoot))
+    {}
+
+    const Document*                         _mDocument;           // either of the two is set
+    const ColumnarDocument*                 _mColumnarDocument;
+    size_t                                  _mScratchSlotCount;   // one per plan node, assigned before '_mRoot' is set
+    std::shared_ptr<const _FilterPlanNode>  _mRoot;
+  };
+
+  inline FilterPlan FilterExpr::Compile(const Document& pDocument) const
+  {
+    return FilterPlan(pDocument, _mNode->compile(pDocument));
+  }
+
+  inline FilterPlan FilterExpr::Compile(const ColumnarDocument& pDocument) const
+  {
+    return FilterPlan(pDocument, _mNode->compile(pDocument));
+  }
+
+  /**
+   * @brief     Class representing a CSV document filtered-view, with filter given as runtime 'FilterExpr'.
+   *            The underlying 'Document' is viewed after applying filter on rows, based on cell values after
+   *            type-conversion.
+   */
+  class ExprFilterDocument : public _ViewDocument
+  {
+  public:
+
+    /**
+     * @brief   Constructor. After excluding the rows as defined by 'pFilter',
+     *          creates bi-directional map between view-rows and actual-csv-rows.
+     * @param   document               'Document' object with CSV data.
+     * @param   pFilter                filter expression, compiled for 'document'.
+     * @param   pResource              memory resource for the view's row maps, if nullptr the
+     *                                 default memory resource is used.
+     */
+    ExprFilterDocument(const Document& document, const FilterExpr& pFilter,
+                       std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(document, pResource)
+    {
+      const FilterPlan plan = pFilter.Compile(document);
+      const std::vector<size_t> rowIdxs = plan.Select();
+      _mapViewRowIdx2RowIdx.assign(rowIdxs.begin(), rowIdxs.end());
+    }
+
+    /**
+     * @brief   Constructor. Refines an existing view : only the view rows of 'parent' are visited, gathered
+     *          in blocks as by 'FilterPlan::Select(pRowIdxs)', and the rows not excluded by 'pFilter' keep
+     *          the view order of 'parent'.
+     *          The new view refers to the Document of 'parent', but not to 'parent' itself.
+     * @param   parent                 view to refine, such as a 'FilterDocument' or 'FilterSortDocument'.
+     * @param   pFilter                filter expression, compiled for the Document of 'parent'.
+     * @param   pResource              memory resource for the view's row maps, if nullptr the
+     *                                 default memory resource is used.
+     */
+    ExprFilterDocument(const _ViewDocument& parent, const FilterExpr& pFilter,
+                       std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(parent, pResource)
+    {
+      const FilterPlan plan = pFilter.Compile(_document);
+      const std::vector<size_t> rowIdxs = plan.Select(_getViewRowIdxs(parent));
+      _mapViewRowIdx2RowIdx.assign(rowIdxs.begin(), rowIdxs.end());
+    }
+
+    /**
+     * @brief   Destructor
+     */
+    virtual ~ExprFilterDocument()
+    {}
+  };
+}
@@ -0,0 +1,514 @@
+/*
+ * hashindex.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <rapidcsv/rapidcsv.h>
+#include <rapidcsv/view.h>
+
+
+namespace rapidcsv
+{
+  /**
+   * @brief     Hash function for the key of 'HashIndex', i.e. tuple of converted cell values.
+   *            Only intended for internal usage, but exposed externally to allow specialization on datatypes.
+   */
+  struct _HashIndexHasher
+  {
+    template< typename ... T >
+    size_t operator() (const std::tuple<T ...>& pKey) const
+    {
+      size_t seed = 0;
+      std::apply([&seed](const T& ... val)
+                 { ( (seed ^= _hashValue(val) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)), ... ); },
+                 pKey);
+      return seed;
+    }
+
+    template< typename T >
+    static size_t _hashValue(const T& pVal)
+    {
+      return std::hash<T>{}(pVal);
+    }
+
+    static size_t _hashValue(const std::chrono::year_month_day& pVal)
+    {
+      const int packed = (static_cast<int>(pVal.year()) << 9) |
+                         static_cast<int>(static_cast<unsigned>(pVal.month()) << 5) |
+                         static_cast<int>(static_cast<unsigned>(pVal.day()));
+      return std::hash<int>{}(packed);
+    }
+
+    template< typename ... T >
+    static size_t _hashValue(const std::variant<T ...>& pVal)
+    {
+      return std::visit([](const auto& val) { return _hashValue(val); }, pVal) ^ pVal.index();
+    }
+  };
+
+  /**
+   * @brief     Key of a Document row, i.e. converted cell values of the key columns. Shared by 'HashIndex',
+   *            'GroupBy' and the join functions. Only intended for internal usage.
+   * @tparam    T_K                   one for each key column.
+   *                                  T can be data-type such as int, double etc ;   xOR
+   *                                  C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   */
+  template< typename ... T_K >
+  struct _RowKey
+  {
+    using t_key = std::tuple<typename converter::t_S2Tconv_c<T_K>::return_type ...>;
+
+    /**
+     * @brief   Convert the key cells of a Document row, checking the row and column indexes.
+     * @param   pDocument             'Document' object with CSV data.
+     * @param   pRowIdx               zero-based row index.
+     * @param   pColumnIdxs           zero-based column indexes, one for each of 'T_K'.
+     * @param   pCaller               caller name, prefix of the error message.
+     * @returns key of the row.
+     */
+    static t_key make(const Document& pDocument, const size_t pRowIdx,
+                      const std::vector<size_t>& pColumnIdxs, const char* pCaller)
+    {
+      if (pRowIdx >= pDocument._getDataRowCount())
+      {
+        const std::string errMsg = std::string(pCaller) + " : row index exceeds number of data rows";
+        RAPIDCSV_DEBUG_LOG(errMsg << " : rowIdx=" << pRowIdx << " , number of data rows=" << pDocument._getDataRowCount());
+        throw std::out_of_range(errMsg);
+      }
+
+      const Document::t_dataRow& row = pDocument._getDataRow(pRowIdx);
+      for (const size_t columnIdx : pColumnIdxs)
+      {
+        if (columnIdx >= row.size())
+        {
+          const std::string errMsg = std::string(pCaller) + " : requested column index is more than row.size()";
+          RAPIDCSV_DEBUG_LOG(errMsg << " : columnIdx=" << columnIdx << " , rowIdx=" << pRowIdx << " , row.size()=" << row.size());
+          throw std::out_of_range(errMsg);
+        }
+      }
+      return make(row, pColumnIdxs);
+    }
+
+    /**
+     * @brief   Convert the key cells of a row, without checks.
+     * @param   pRowData              row cells, with each of 'pColumnIdxs' less than its size.
+     * @param   pColumnIdxs           zero-based column indexes, one for each of 'T_K'.
+     * @returns key of the row.
+     */
+    static inline t_key make(const Document::t_dataRow& pRowData, const std::vector<size_t>& pColumnIdxs)
+    {
+      return _make(pRowData, pColumnIdxs, std::index_sequence_for<T_K ...>{});
+    }
+
+  private:
+    template< size_t ... I >
+    static inline t_key _make(const Document::t_dataRow& pRowData, const std::vector<size_t>& pColumnIdxs,
+                              std::index_sequence<I ...>)
+    {
+      return t_key{ _S2Tdispatch<T_K>(pRowData[pColumnIdxs[I]]) ... };
+    }
+  };
+
+  /**
+   * @brief     Class representing a hash index on one or more columns of a CSV document, mapping each key
+   *            (cell values after type-conversion) to the indexes of the rows having that key.
+   *            Lookup is O(1) expected. The index is brought up to date with the Document by 'Refresh()',
+   *            which replays the Document's row change log, i.e. inserted, removed and updated rows.
+   *            'InsertRows()' / 'RemoveRows()' do the same, after checking that the Document changed
+   *            only by that insert / remove. Any other change to the Document invalidates the index until
+   *            it is refreshed. Changes by writing to a row reference (e.g. from 'Document::EmplaceRow()')
+   *            are not recorded in the change log, hence not detected.
+   * @tparam    T_C                   one for each key column.
+   *                                  T can be data-type such as int, double etc ;   xOR
+   *                                  C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   */
+  template< typename ... T_C >
+  class HashIndex
+  {
+    static_assert(sizeof...(T_C) > 0, "HashIndex needs at least one key column");
+
+  public:
+    /**
+     * @brief   key of the index, converted cell values of the key columns.
+     */
+    using t_key = std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>;
+
+    /**
+     * @brief   Constructor. Indexes all rows of the Document.
+     * @param   pDocument             'Document' object with CSV data.
+     * @param   pColumnNameIdx        column-name or zero-based column-index, one for each of 'T_C'.
+     */
+    template< c_sizet_or_string ... T_N >
+      requires (sizeof...(T_N) == sizeof...(T_C))
+    explicit HashIndex(const Document& pDocument, const T_N& ... pColumnNameIdx)
+      : _mDocument(pDocument)
+      , _mColumns{ _ColumnRef(pColumnNameIdx) ... }
+      , _mColumnIdxs()
+      , _mIndex()
+      , _mRowEntries()
+      , _mRowChangeSeq(0)
+    {
+      _build();
+    }
+
+    /**
+     * @brief   Copy constructor.
+     * @param   pOther                index to copy.
+     */
+    HashIndex(const HashIndex& pOther)
+      : _mDocument(pOther._mDocument)
+      , _mColumns(pOther._mColumns)
+      , _mColumnIdxs(pOther._mColumnIdxs)
+      , _mIndex(pOther._mIndex)
+      , _mRowEntries(pOther._mRowEntries.size(), nullptr)
+      , _mRowChangeSeq(pOther._mRowChangeSeq)
+    {
+      for (t_entry& entry : _mIndex)
+      {
+        for (const size_t rowIdx : entry.second)
+        {
+          _mRowEntries[rowIdx] = &entry;
+        }
+      }
+    }
+
+    HashIndex(HashIndex&&) = default;
+
+    /**
+     * @brief   Get indexes of rows matching a key.
+     * @param   pKey                  converted cell values of the key columns.
+     * @returns zero-based row indexes in ascending order, empty if no row matches.
+     */
+    std::span<const size_t> GetRowIdxs(const t_key& pKey) const
+    {
+      _checkValid("rapidcsv::HashIndex::GetRowIdxs() : Document rows have changed after the index was updated");
+      const auto itKey = _mIndex.find(pKey);
+      if (itKey == _mIndex.end())
+      {
+        return std::span<const size_t>();
+      }
+      return std::span<const size_t>(itKey->second);
+    }
+
+    /**
+     * @brief   Check if any row matches a key.
+     * @param   pKey                  converted cell values of the key columns.
+     * @returns true if at least one row has the key.
+     */
+    inline bool Contains(const t_key& pKey) const
+    {
+      return !GetRowIdxs(pKey).empty();
+    }
+
+    /**
+     * @brief   Get number of distinct keys.
+     * @returns key count.
+     */
+    inline size_t GetKeyCount() const
+    {
+      return _mIndex.size();
+    }
+
+    /**
+     * @brief   Get number of rows indexed.
+     * @returns row count.
+     */
+    inline size_t GetRowCount() const
+    {
+      return _mRowEntries.size();
+    }
+
+    /**
+     * @brief   Get the Document the index was built on.
+     * @returns 'Document' object.
+     */
+    inline const Document& GetDocument() const
+    {
+      return _mDocument;
+    }
+
+    /**
+     * @brief   Check if the Document rows are unchanged since the index was created or last updated.
+     * @returns true if index can be used.
+     */
+    inline bool IsValid() const
+    {
+      return _mRowChangeSeq == _mDocument.GetRowChangeSeq();
+    }
+
+    /**
+     * @brief   Bring the index up to date with the row changes of the Document since the index was created
+     *          or last updated, as recorded in the Document's row change log. Keys are created only for
+     *          inserted and updated rows; an updated row whose key is unchanged keeps its entry.
+     *          Appending 'Δ' rows, or removing the last 'Δ' rows, costs O(Δ) expected. Insert or remove of
+     *          rows before other rows shifts the indexes of the 'm' following rows, O(m log k) for keys of
+     *          at most 'k' rows each. The index is rebuilt if the changes are no longer in the change log,
+     *          or on 'Clear()', 'Load()' or insert/remove of columns; key columns given by name are then
+     *          looked up again, those given by index keep their index.
+     */
+    void Refresh()
+    {
+      if (_mRowChangeSeq < _mDocument.GetRowChangeFirstSeq())
+      {
+        _build();
+        return;
+      }
+
+      // rows without entry, i.e. inserted or updated, as indexes after the changes replayed so far
+      std::vector<size_t> pendingRowIdxs;
+      for (const RowChange& rowChange : _mDocument.GetRowChanges(_mRowChangeSeq))
+      {
+        const size_t beginRowIdx = rowChange.mRowIdx;
+        const size_t endRowIdx = rowChange.mRowIdx + rowChange.mRowCount;
+        switch (rowChange.mChange)
+        {
+          case ROWS_INSERTED :
+            _insertRows(beginRowIdx, rowChange.mRowCount);
+            for (size_t& rowIdx : pendingRowIdxs)
+            {
+              if (rowIdx >= beginRowIdx)  rowIdx += rowChange.mRowCount;
+            }
+            for (size_t rowIdx = beginRowIdx; rowIdx < endRowIdx; ++rowIdx)
+            {
+              pendingRowIdxs.push_back(rowIdx);
+            }
+            break;
+          case ROWS_REMOVED :
+            _removeRows(beginRowIdx, rowChange.mRowCount);
+            pendingRowIdxs.erase(std::remove_if(pendingRowIdxs.begin(), pendingRowIdxs.end(),
+                                                [beginRowIdx, endRowIdx](const size_t rowIdx)
+                                                { return (rowIdx >= beginRowIdx) && (rowIdx < endRowIdx); }),
+                                 pendingRowIdxs.end());
+            for (size_t& rowIdx : pendingRowIdxs)
+            {
+              if (rowIdx >= endRowIdx)  rowIdx -= rowChange.mRowCount;
+            }
+            break;
+          case ROWS_UPDATED :
+            for (size_t rowIdx = beginRowIdx; rowIdx < endRowIdx; ++rowIdx)
+            {
+              _dropRow(rowIdx);
+              pendingRowIdxs.push_back(rowIdx);
+            }
+            break;
+          case ROWS_RESET :
+          default :
+            _build();
+            return;
+        }
+      }
+
+      std::sort(pendingRowIdxs.begin(), pendingRowIdxs.end());
+      pendingRowIdxs.erase(std::unique(pendingRowIdxs.begin(), pendingRowIdxs.end()), pendingRowIdxs.end());
+      for (const size_t rowIdx : pendingRowIdxs)
+      {
+        _addRow(rowIdx);
+      }
+      _mRowChangeSeq = _mDocument.GetRowChangeSeq();
+    }
+
+    /**
+     * @brief   Update the index after rows were inserted in the Document, e.g. by 'Document::InsertRow()',
+     *          'InsertRows()' or 'AppendRows()'. Same as 'Refresh()', after checking that the Document changed
+     *          only by inserting 'pCount' rows within the range.
+     * @param   pRowIdx               zero-based row index of the first inserted row.
+     * @param   pCount                number of inserted rows.
+     */
+    void InsertRows(const size_t pRowIdx, const size_t pCount)
+    {
+      _checkChanges("rapidcsv::HashIndex::InsertRows() : Document rows have changed other than by inserting the rows, use Refresh()",
+                    ROWS_INSERTED, pRowIdx, pCount);
+      Refresh();
+    }
+
+    /**
+     * @brief   Update the index after a row was inserted in the Document.
+     * @param   pRowIdx               zero-based row index passed to 'Document::InsertRow()'.
+     */
+    inline void InsertRow(const size_t pRowIdx)
+    {
+      InsertRows(pRowIdx, 1);
+    }
+
+    /**
+     * @brief   Update the index after rows were removed from the Document, e.g. by calls of 'Document::RemoveRow()'.
+     *          Same as 'Refresh()', after checking that the Document changed only by removing 'pCount' rows
+     *          within the range.
+     * @param   pRowIdx               zero-based row index of the first removed row.
+     * @param   pCount                number of removed rows.
+     */
+    void RemoveRows(const size_t pRowIdx, const size_t pCount)
+    {
+      _checkChanges("rapidcsv::HashIndex::RemoveRows() : Document rows have changed other than by removing the rows, use Refresh()",
+                    ROWS_REMOVED, pRowIdx, pCount);
+      Refresh();
+    }
+
+    /**
+     * @brief   Update the index after a row was removed from the Document.
+     * @param   pRowIdx               zero-based row index of the removed row.
+     */
+    inline void RemoveRow(const size_t pRowIdx)
+    {
+      RemoveRows(pRowIdx, 1);
+    }
+
+  private:
+    using t_index = std::unordered_map<t_key, std::vector<size_t>, _HashIndexHasher>;
+    using t_entry = typename t_index::value_type;
+
+    inline t_key _makeKey(const size_t pRowIdx) const
+    {
+      return _RowKey<T_C ...>::make(_mDocument, pRowIdx, _mColumnIdxs, "rapidcsv::HashIndex");
+    }
+
+    void _build()
+    {
+      // column names are resolved again, as columns may have been inserted/removed before a reset
+      _mColumnIdxs.clear();
+      for (const _ColumnRef& column : _mColumns)
+      {
+        _mColumnIdxs.push_back(column.resolve(_mDocument));
+      }
+
+      const size_t rowCount = _mDocument._getDataRowCount();
+      _mIndex.clear();
+      _mIndex.reserve(rowCount);
+      _mRowEntries.assign(rowCount, nullptr);
+      for (size_t rowIdx = 0; rowIdx < rowCount; ++rowIdx)
+      {
+        _addRow(rowIdx);
+      }
+      _mRowChangeSeq = _mDocument.GetRowChangeSeq();
+    }
+
+    void _addRow(const size_t pRowIdx)
+    {
+      t_entry& entry = *_mIndex.try_emplace(_makeKey(pRowIdx)).first;
+      std::vector<size_t>& rowIdxs = entry.second;
+      if (rowIdxs.empty() || (rowIdxs.back() < pRowIdx))
+      {
+        rowIdxs.push_back(pRowIdx);
+      } else {
+        rowIdxs.insert(std::lower_bound(rowIdxs.begin(), rowIdxs.end(), pRowIdx), pRowIdx);
+      }
+      _mRowEntries[pRowIdx] = &entry;
+    }
+
+    void _dropRow(const size_t pRowIdx)
+    {
+      t_entry* const entry = _mRowEntries[pRowIdx];
+      if (entry == nullptr)
+      {
+        return;
+      }
+
+      std::vector<size_t>& rowIdxs = entry->second;
+      rowIdxs.erase(std::lower_bound(rowIdxs.begin(), rowIdxs.end(), pRowIdx));
+      if (rowIdxs.empty())
+      {
+        _mIndex.erase(_mIndex.find(entry->first));
+      }
+      _mRowEntries[pRowIdx] = nullptr;
+    }
+
+    // the rows at 'pRowIdx' and after move down by 'pCount'; the inserted rows have no entry yet.
+    void _insertRows(const size_t pRowIdx, const size_t pCount)
+    {
+      // from the last row, so that the row indexes of an entry stay ordered
+      for (size_t rowIdx = _mRowEntries.size(); rowIdx > pRowIdx; --rowIdx)
+      {
+        _shiftRow(rowIdx - 1, static_cast<ssize_t>(pCount));
+      }
+      _mRowEntries.insert(_mRowEntries.begin() + static_cast<ssize_t>(pRowIdx), pCount, nullptr);
+    }
+
+    // the rows after the removed rows [pRowIdx, pRowIdx+pCount) move up by 'pCount'.
+    void _removeRows(const size_t pRowIdx, const size_t pCount)
+    {
+      const size_t endRowIdx = pRowIdx + pCount;
+      for (size_t rowIdx = pRowIdx; rowIdx < endRowIdx; ++rowIdx)
+      {
+        _dropRow(rowIdx);
+      }
+      for (size_t rowIdx = endRowIdx; rowIdx < _mRowEntries.size(); ++rowIdx)
+      {
+        _shiftRow(rowIdx, -static_cast<ssize_t>(pCount));
+      }
+      _mRowEntries.erase(_mRowEntries.begin() + static_cast<ssize_t>(pRowIdx),
+                         _mRowEntries.begin() + static_cast<ssize_t>(endRowIdx));
+    }
+
+    inline void _shiftRow(const size_t pRowIdx, const ssize_t pOffset)
+    {
+      t_entry* const entry = _mRowEntries[pRowIdx];
+      if (entry != nullptr)
+      {
+        std::vector<size_t>& rowIdxs = entry->second;
+        size_t& rowIdx = *std::lower_bound(rowIdxs.begin(), rowIdxs.end(), pRowIdx);
+        rowIdx = static_cast<size_t>(static_cast<ssize_t>(rowIdx) + pOffset);
+      }
+    }
+
+    void _checkValid(const char* pErrMsg) const
+    {
+      if (!IsValid())
+      {
+        RAPIDCSV_DEBUG_LOG(pErrMsg << " : index change seq=" << _mRowChangeSeq << " , document change seq=" << _mDocument.GetRowChangeSeq());
+        throw std::out_of_range(pErrMsg);
+      }
+    }
+
+    // all changes since the last update are of kind 'pChange', within the rows [pRowIdx, pRowIdx+pCount), 'pCount' rows in total.
+    void _checkChanges(const char* pErrMsg, const e_RowChange pChange, const size_t pRowIdx, const size_t pCount) const
+    {
+      bool isExpected = (_mRowChangeSeq >= _mDocument.GetRowChangeFirstSeq());
+      size_t rowCount = 0;
+      if (isExpected)
+      {
+        for (const RowChange& rowChange : _mDocument.GetRowChanges(_mRowChangeSeq))
+        {
+          isExpected = isExpected && (rowChange.mChange == pChange) && (rowChange.mRowIdx >= pRowIdx) &&
+                       ((rowChange.mRowIdx + ((pChange == ROWS_INSERTED) ? rowChange.mRowCount : 1)) <= (pRowIdx + pCount));
+          rowCount += rowChange.mRowCount;
+        }
+      }
+
+      if (!isExpected || (rowCount != pCount))
+      {
+        RAPIDCSV_DEBUG_LOG(pErrMsg << " : pRowIdx=" << pRowIdx << " , pCount=" << pCount << " , changed rows=" << rowCount
+                                   << " , indexed rows=" << _mRowEntries.size() << " , document rows=" << _mDocument._getDataRowCount());
+        throw std::out_of_range(pErrMsg);
+      }
+    }
+
+    const Document&                 _mDocument;
+    const std::vector<_ColumnRef>   _mColumns;
+    std::vector<size_t>             _mColumnIdxs;     // resolved '_mColumns', as of the last rebuild
+    t_index                         _mIndex;
+    std::vector<t_entry*>           _mRowEntries;     // entry of each row, nullptr while a row is pending in 'Refresh()'
+    size_t                          _mRowChangeSeq;   // row change sequence number of the Document, when last updated
+  };
+}
@@ -0,0 +1,505 @@
+/*
+ * join.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <limits>
+#include <span>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <rapidcsv/view.h>
+#include <rapidcsv/hashindex.h>
+
+
+namespace rapidcsv
+{
+  enum e_JoinType
+  {
+    JOIN_INNER = 0,   // pairs of matching left and right rows
+    JOIN_LEFT,        // as JOIN_INNER, and left rows without match paired with 'JoinDocument::npos'
+    JOIN_SEMI         // left rows having at least one match, once each
+  };
+
+  /**
+   * @brief     Class representing the key columns of one side of a join.
+   * @tparam    T_K                   one for each key column, same for both sides of a join.
+   *                                  T can be data-type such as int, double etc ;   xOR
+   *                                  C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   */
+  template< typename ... T_K >
+  class JoinKeyParams
+  {
+    static_assert(sizeof...(T_K) > 0, "JoinKeyParams needs at least one key column");
+
+  public:
+    /**
+     * @brief   key of a row, converted cell values of the key columns.
+     */
+    using t_key = std::tuple<typename converter::t_S2Tconv_c<T_K>::return_type ...>;
+
+    /**
+     * @brief   Constructor
+     * @param   pKeyColumnNameIdx     column-name or zero-based column-index, one for each of 'T_K'.
+     */
+    template< c_sizet_or_string ... T_N >
+      requires (sizeof...(T_N) == sizeof...(T_K))
+    explicit JoinKeyParams(const T_N& ... pKeyColumnNameIdx)
+      : _mKeyColumns{ _ColumnRef(pKeyColumnNameIdx) ... }
+    {}
+
+    /**
+     * @brief   Get key column indexes in a Document.
+     * @param   pDocument             'Document' object with CSV data.
+     * @returns zero-based column indexes, one for each of 'T_K'.
+     */
+    std::vector<size_t> getColumnIdxs(const Document& pDocument) const
+    {
+      std::vector<size_t> columnIdxs;
+      for (const _ColumnRef& keyColumn : _mKeyColumns)
+      {
+        columnIdxs.push_back(keyColumn.resolve(pDocument));
+      }
+      return columnIdxs;
+    }
+
+  private:
+    const std::vector<_ColumnRef> _mKeyColumns;
+  };
+
+  /**
+   * @brief     One side of a join, i.e. rows of a Document or of a view in view order.
+   *            Only intended for internal usage.
+   */
+  class _JoinSide
+  {
+  public:
+    _JoinSide(const Document& pDocument)
+      : _mDocument(pDocument)
+      , _mView(nullptr)
+    {}
+
+    _JoinSide(const _ViewDocument& pView)
+      : _mDocument(pView.GetDocument())
+      , _mView(&pView)
+    {}
+
+    inline const Document& getDocument() const
+    {
+      return _mDocument;
+    }
+
+    inline size_t getRowCount() const
+    {
+      return (_mView != nullptr) ? _mView->GetViewRowCount() : _mDocument._getDataRowCount();
+    }
+
+    inline size_t getDocumentRowIdx(const size_t pPos) const
+    {
+      return (_mView != nullptr) ? _mView->GetDocumentRowIdx(pPos) : pPos;
+    }
+
+    template< typename ... T_K >
+    inline typename _RowKey<T_K ...>::t_key makeKey(const size_t pRowIdx, const std::vector<size_t>& pColumnIdxs) const
+    {
+      return _RowKey<T_K ...>::make(_mDocument, pRowIdx, pColumnIdxs, "rapidcsv::Join");
+    }
+
+  private:
+    const Document&       _mDocument;
+    const _ViewDocument*  _mView;
+  };
+
+  /**
+   * @brief     Class representing the result of a join, as pairs of document row indexes of the left
+   *            and right Documents. Cells are not copied, but read from the joined Documents.
+   */
+  class JoinDocument
+  {
+  public:
+    /**
+     * @brief   right row index of a left row without match (JOIN_LEFT), and of all rows of JOIN_SEMI.
+     */
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief   Constructor, used by the join functions.
+     * @param   pLeft                 left 'Document' object.
+     * @param   pRight                right 'Document' object.
+     * @param   pJoinType             type of the join.
+     * @param   pRowIdxPairs          pairs of zero-based document row indexes (left, right).
+     */
+    JoinDocument(const Document& pLeft, const Document& pRight, const e_JoinType pJoinType,
+                 std::vector<std::pair<size_t, size_t>>&& pRowIdxPairs)
+      : _mLeft(pLeft)
+      , _mRight(pRight)
+      , _mJoinType(pJoinType)
+      , _mRowIdxPairs(std::move(pRowIdxPairs))
+    {}
+
+    /**
+     * @brief   Get number of joined rows.
+     * @returns row count.
+     */
+    inline size_t GetRowCount() const
+    {
+      return _mRowIdxPairs.size();
+    }
+
+    /**
+     * @brief   Get type of the join.
+     * @returns join type.
+     */
+    inline e_JoinType GetJoinType() const
+    {
+      return _mJoinType;
+    }
+
+    /**
+     * @brief   Get left document row index of a joined row.
+     * @param   pJoinRowIdx           zero-based joined row index.
+     * @returns zero-based row index in the left Document.
+     */
+    inline size_t GetLeftRowIdx(const size_t pJoinRowIdx) const
+    {
+      return _mRowIdxPairs.at(pJoinRowIdx).first;
+    }
+
+    /**
+     * @brief   Get right document row index of a joined row.
+     * @param   pJoinRowIdx           zero-based joined row index.
+     * @returns zero-based row index in the right Document, 'npos' if the left row has no match.
+     */
+    inline size_t GetRightRowIdx(const size_t pJoinRowIdx) const
+    {
+      return _mRowIdxPairs.at(pJoinRowIdx).second;
+    }
+
+    /**
+     * @brief   Get pairs of document row indexes of all joined rows.
+     * @returns pairs (left row index, right row index).
+     */
+    inline std::span<const std::pair<size_t, size_t>> GetRowIdxPairs() const
+    {
+      return std::span<const std::pair<size_t, size_t>>(_mRowIdxPairs);
+    }
+
+    /**
+     * @brief   Get cell of the left Document.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;    xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index of the left Document.
+     * @param   pJoinRowIdx           zero-based joined row index.
+     * @returns cell data of type R. By default, R is usually same type as T.
+     */
+    template< typename T_C >
+    typename converter::t_S2Tconv_c<T_C>::return_type
+    GetLeftCell(const c_sizet_or_string auto& pColumnNameIdx, const size_t pJoinRowIdx) const
+    {
+      return _mLeft.GetCell<T_C>(_mLeft.GetColumnIdx(pColumnNameIdx), GetLeftRowIdx(pJoinRowIdx));
+    }
+
+    /**
+     * @brief   Get cell of the right Document.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;    xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index of the right Document.
+     * @param   pJoinRowIdx           zero-based joined row index.
+     * @returns cell data of type R. By default, R is usually same type as T.
+     *          If the left row has no match, then 'out_of_range' error is thrown.
+     */
+    template< typename T_C >
+    typename converter::t_S2Tconv_c<T_C>::return_type
+    GetRightCell(const c_sizet_or_string auto& pColumnNameIdx, const size_t pJoinRowIdx) const
+    {
+      const size_t rightRowIdx = GetRightRowIdx(pJoinRowIdx);
+      if (rightRowIdx == npos)
+      {
+        static const std::string errMsg("rapidcsv::JoinDocument::GetRightCell() : joined row has no right row");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pJoinRowIdx=" << pJoinRowIdx);
+        throw std::out_of_range(errMsg);
+      }
+      return _mRight.GetCell<T_C>(_mRight.GetColumnIdx(pColumnNameIdx), rightRowIdx);
+    }
+
+    /**
+     * @brief   Get the left Document.
+     * @returns left 'Document' object.
+     */
+    inline const Document& GetLeftDocument() const
+    {
+      return _mLeft;
+    }
+
+    /**
+     * @brief   Get the right Document.
+     * @returns right 'Document' object.
+     */
+    inline const Document& GetRightDocument() const
+    {
+      return _mRight;
+    }
+
+  private:
+    const Document&                              _mLeft;
+    const Document&                              _mRight;
+    const e_JoinType                             _mJoinType;
+    std::vector<std::pair<size_t, size_t>>  _mRowIdxPairs;
+  };
+
+  /**
+   * @brief     Adds the joined rows of a left row, given the right rows matching its key.
+   *            Only intended for internal usage.
+   */
+  inline void _addJoinedRows(std::vector<std::pair<size_t, size_t>>& pRowIdxPairs, const e_JoinType pJoinType,
+                             const size_t pLeftRowIdx, std::span<const size_t> pRightRowIdxs)
+  {
+    if (pJoinType == e_JoinType::JOIN_SEMI)
+    {
+      if (!pRightRowIdxs.empty())
+      {
+        pRowIdxPairs.emplace_back(pLeftRowIdx, JoinDocument::npos);
+      }
+      return;
+    }
+
+    for (const size_t rightRowIdx : pRightRowIdxs)
+    {
+      pRowIdxPairs.emplace_back(pLeftRowIdx, rightRowIdx);
+    }
+    if (pRightRowIdxs.empty() && (pJoinType == e_JoinType::JOIN_LEFT))
+    {
+      pRowIdxPairs.emplace_back(pLeftRowIdx, JoinDocument::npos);
+    }
+  }
+
+  /**
+   * @brief   Hash join, building a hash table on the right rows and probing it with the left rows.
+   *          Joined rows are in order of the left rows, then of the right rows.
+   * @tparam  T_K                   one for each key column.
+   * @param   pLeft                 left 'Document' or view.
+   * @param   pLeftKey              key columns of the left side.
+   * @param   pRight                right 'Document' or view.
+   * @param   pRightKey             key columns of the right side.
+   * @param   pJoinType             type of the join. Default: JOIN_INNER
+   * @returns 'JoinDocument' of row index pairs.
+   */
+  template< typename ... T_K >
+  JoinDocument HashJoin(const _JoinSide& pLeft, const JoinKeyParams<T_K ...>& pLeftKey,
+                        const _JoinSide& pRight, const JoinKeyParams<T_K ...>& pRightKey,
+                        const e_JoinType pJoinType = e_JoinType::JOIN_INNER)
+  {
+    using t_key = typename JoinKeyParams<T_K ...>::t_key;
+
+    const std::vector<size_t> rightColumnIdxs = pRightKey.getColumnIdxs(pRight.getDocument());
+    std::unordered_map<t_key, std::vector<size_t>, _HashIndexHasher> table;
+    table.reserve(pRight.getRowCount());
+    for (size_t pos = 0; pos < pRight.getRowCount(); ++pos)
+    {
+      const size_t rowIdx = pRight.getDocumentRowIdx(pos);
+      table[pRight.makeKey<T_K ...>(rowIdx, rightColumnIdxs)].push_back(rowIdx);
+    }
+
+    const std::vector<size_t> leftColumnIdxs = pLeftKey.getColumnIdxs(pLeft.getDocument());
+    std::vector<std::pair<size_t, size_t>> rowIdxPairs;
+    rowIdxPairs.reserve(pLeft.getRowCount());
+    for (size_t pos = 0; pos < pLeft.getRowCount(); ++pos)
+    {
+      const size_t rowIdx = pLeft.getDocumentRowIdx(pos);
+      const auto itKey = table.find(pLeft.makeKey<T_K ...>(rowIdx, leftColumnIdxs));
+      _addJoinedRows(rowIdxPairs, pJoinType, rowIdx,
+                     (itKey != table.end()) ? std::span<const size_t>(itKey->second) : std::span<const size_t>());
+    }
+
+    return JoinDocument(pLeft.getDocument(), pRight.getDocument(), pJoinType, std::move(rowIdxPairs));
+  }
+
+  /**
+   * @brief   Hash join, probing an existing 'HashIndex' of the right Document with the left rows.
+   *          Joined rows are in order of the left rows, then of the right rows.
+   * @tparam  T_K                   one for each key column.
+   * @param   pLeft                 left 'Document' or view.
+   * @param   pLeftKey              key columns of the left side.
+   * @param   pRight                'HashIndex' on the key columns of the right Document.
+   * @param   pJoinType             type of the join. Default: JOIN_INNER
+   * @returns 'JoinDocument' of row index pairs.
+   */
+  template< typename ... T_K >
+  JoinDocument HashJoin(const _JoinSide& pLeft, const JoinKeyParams<T_K ...>& pLeftKey,
+                        const HashIndex<T_K ...>& pRight,
+                        const e_JoinType pJoinType = e_JoinType::JOIN_INNER)
+  {
+    const std::vector<size_t> leftColumnIdxs = pLeftKey.getColumnIdxs(pLeft.getDocument());
+    std::vector<std::pair<size_t, size_t>> rowIdxPairs;
+    rowIdxPairs.reserve(pLeft.getRowCount());
+    for (size_t pos = 0; pos < pLeft.getRowCount(); ++pos)
+    {
+      const size_t rowIdx = pLeft.getDocumentRowIdx(pos);
+      _addJoinedRows(rowIdxPairs, pJoinType, rowIdx,
+                     pRight.GetRowIdxs(pLeft.makeKey<T_K ...>(rowIdx, leftColumnIdxs)));
+    }
+
+    return JoinDocument(pLeft.getDocument(), pRight.GetDocument(), pJoinType, std::move(rowIdxPairs));
+  }
+
+  template< typename T_TUPLE, size_t ... I >
+  inline auto _tiePrefix(const T_TUPLE& pTuple, std::index_sequence<I ...>)
+  {
+    return std::tie(std::get<I>(pTuple) ...);
+  }
+
+  /**
+   * @brief   Sort-merge join of two sort-views on their first 'JOIN_KEY_COUNT' SortParams, whose types must be
+   *          same for both views. As a 'FilterSortDocument' collapses rows with equal sort-keys, further
+   *          SortParams (e.g. trade-id, row-id) on either view keep rows with the same join key distinct. Each
+   *          left row is paired with every right row of its join key, so one-to-many and many-to-many joins give
+   *          the same row pairs as 'HashJoin' on the same views. Both views are walked once, i.e. O(n + m) plus
+   *          the number of joined rows. Joined rows are in view order of the left side, then of the right side.
+   * @tparam  JOIN_KEY_COUNT        number of leading SortParams forming the join key.
+   * @tparam  evalLeft              filter of the left view.
+   * @tparam  SPleft                variadic list of SortParams of the left view.
+   * @tparam  evalRight             filter of the right view.
+   * @tparam  SPright               variadic list of SortParams of the right view.
+   * @param   pLeft                 left sort-view.
+   * @param   pRight                right sort-view.
+   * @param   pJoinType             type of the join. Default: JOIN_INNER
+   * @returns 'JoinDocument' of row index pairs.
+   */
+  template< size_t JOIN_KEY_COUNT,
+            f_EvalBoolExpr evalLeft, c_SortParams ... SPleft,
+            f_EvalBoolExpr evalRight, c_SortParams ... SPright >
+  JoinDocument MergeJoin(const FilterSortDocument<evalLeft, SPleft ...>& pLeft,
+                         const FilterSortDocument<evalRight, SPright ...>& pRight,
+                         const e_JoinType pJoinType = e_JoinType::JOIN_INNER)
+  {
+    static_assert( (0 < JOIN_KEY_COUNT) && (JOIN_KEY_COUNT <= sizeof...(SPleft)) && (JOIN_KEY_COUNT <= sizeof...(SPright)),
+                   "MergeJoin : both views need the join key SortParams" );
+    static_assert( []<size_t ... I>(std::index_sequence<I ...>)
+                   {
+                     return ( std::is_same_v< std::tuple_element_t<I, std::tuple<SPleft ...>>,
+                                              std::tuple_element_t<I, std::tuple<SPright ...>> > && ... );
+                   }(std::make_index_sequence<JOIN_KEY_COUNT>{}),
+                   "MergeJoin : join key SortParams types must be same for both views" );
+
+    using t_leftComparator = _RowComparator<SPleft ...>;
+    const auto leftEntries  = pLeft.GetSortEntries();
+    const auto rightEntries = pRight.GetSortEntries();
+    auto compareKey = [](const auto& pLeftEntry, const auto& pRightEntry)
+    {
+      return t_leftComparator::comparePrefix(pLeftEntry.first,
+                                             _tiePrefix(pRightEntry.first, std::make_index_sequence<JOIN_KEY_COUNT>{}));
+    };
+
+    std::vector<std::pair<size_t, size_t>> rowIdxPairs;
+    rowIdxPairs.reserve(leftEntries.size());
+    std::vector<size_t> rightRowIdxs;  // right rows of the current join key
+    auto itRight    = rightEntries.begin();  // first right entry not before the current join key
+    auto itRightEnd = rightEntries.begin();  // first right entry after the current join key
+    for (auto itLeft = leftEntries.begin(); itLeft != leftEntries.end(); ++itLeft)
+    {
+      while ( (itRight != rightEntries.end()) && (compareKey(*itLeft, *itRight) > 0) )
+      {
+        ++itRight;
+      }
+
+      if (itRightEnd <= itRight)
+      {
+        // join key changed : collect the right rows of the new join key
+        itRightEnd = itRight;
+        rightRowIdxs.clear();
+        while ( (itRightEnd != rightEntries.end()) && (compareKey(*itLeft, *itRightEnd) == 0) )
+        {
+          rightRowIdxs.push_back(itRightEnd->second);
+          ++itRightEnd;
+        }
+      }
+
+      _addJoinedRows(rowIdxPairs, pJoinType, itLeft->second, rightRowIdxs);
+    }
+
+    return JoinDocument(pLeft.GetDocument(), pRight.GetDocument(), pJoinType, std::move(rowIdxPairs));
+  }
+
+  /**
+   * @brief   As-of join of two sort-views: each left row is paired with the last right row whose sort-key is at or
+   *          before the left row's sort-key, within the same partition. The first 'PARTITION_KEY_COUNT' SortParams
+   *          of both views are the partition (e.g. symbol), the next one is the ordering column (e.g. timestamp),
+   *          which must be ascending; these SortParams types must be same for both views. Further SortParams of the
+   *          left view (e.g. trade-id) keep rows with equal timestamps distinct. Both views are walked once,
+   *          i.e. O(n + m). Joined rows are in view order of the left side.
+   * @tparam  PARTITION_KEY_COUNT   number of leading SortParams forming the partition. Default: 0
+   * @tparam  evalLeft              filter of the left view.
+   * @tparam  SPleft                variadic list of SortParams of the left view.
+   * @tparam  evalRight             filter of the right view.
+   * @tparam  SPright               variadic list of SortParams of the right view.
+   * @param   pLeft                 left sort-view, e.g. trades.
+   * @param   pRight                right sort-view, e.g. quotes.
+   * @param   pJoinType             type of the join. Default: JOIN_INNER
+   * @param   pAllowExactMatch      if false, only right rows strictly before the left row match. Default: true
+   * @returns 'JoinDocument' of row index pairs.
+   */
+  template< size_t PARTITION_KEY_COUNT = 0,
+            f_EvalBoolExpr evalLeft, c_SortParams ... SPleft,
+            f_EvalBoolExpr evalRight, c_SortParams ... SPright >
+  JoinDocument AsOfJoin(const FilterSortDocument<evalLeft, SPleft ...>& pLeft,
+                        const FilterSortDocument<evalRight, SPright ...>& pRight,
+                        const e_JoinType pJoinType = e_JoinType::JOIN_INNER,
+                        const bool pAllowExactMatch = true)
+  {
+    constexpr size_t keyCount = PARTITION_KEY_COUNT + 1;
+    static_assert( (keyCount <= sizeof...(SPleft)) && (keyCount <= sizeof...(SPright)),
+                   "AsOfJoin : both views need partition and ordering SortParams" );
+    static_assert( []<size_t ... I>(std::index_sequence<I ...>)
+                   {
+                     return ( std::is_same_v< std::tuple_element_t<I, std::tuple<SPleft ...>>,
+                                              std::tuple_element_t<I, std::tuple<SPright ...>> > && ... );
+                   }(std::make_index_sequence<keyCount>{}),
+                   "AsOfJoin : partition and ordering SortParams types must be same for both views" );
+    static_assert( std::tuple_element_t<PARTITION_KEY_COUNT, std::tuple<SPleft ...>>::sortOrder == e_SortOrder::ASCEND,
+                   "AsOfJoin : ordering SortParams must be ascending" );
+
+    using t_leftComparator = _RowComparator<SPleft ...>;
+    const auto leftEntries  = pLeft.GetSortEntries();
+    const auto rightEntries = pRight.GetSortEntries();
+
+    std::vector<std::pair<size_t, size_t>> rowIdxPairs;
+    rowIdxPairs.reserve(leftEntries.size());
+    auto itRight     = rightEntries.begin();
+    auto itCandidate = rightEntries.end();  // last right entry at or before the current left entry
+    for (auto itLeft = leftEntries.begin(); itLeft != leftEntries.end(); ++itLeft)
+    {
+      while (itRight != rightEntries.end())
+      {
+        const int cmp = t_leftComparator::comparePrefix(itLeft->first,
+                                                        _tiePrefix(itRight->first, std::make_index_sequence<keyCount>{}));
+        if ( (cmp < 0) || ((cmp == 0) && !pAllowExactMatch) )
+        {
+          break;
+        }
+        itCandidate = itRight;
+        ++itRight;
+      }
+
+      const bool isMatch = (itCandidate != rightEntries.end()) &&
+                           (t_leftComparator::comparePrefix(itLeft->first,
+                                                            _tiePrefix(itCandidate->first, std::make_index_sequence<PARTITION_KEY_COUNT>{})) == 0);
+      _addJoinedRows(rowIdxPairs, pJoinType, itLeft->second,
+                     isMatch ? std::span<const size_t>(&itCandidate->second, 1) : std::span<const size_t>());
+    }
+
+    return JoinDocument(pLeft.GetDocument(), pRight.GetDocument(), pJoinType, std::move(rowIdxPairs));
+  }
+}
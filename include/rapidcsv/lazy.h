@@ -0,0 +1,762 @@
+/*
+ * lazy.h
+ *
+ * URL:      https://github.com/panchaBhuta/rapidcsv_FilterSort
+ * Version:  v4.0.6
+ *
+ * Copyright (C) 2022-2024 Gautam Dhar
+ * All rights reserved.
+ *
+ * rapidcsv is distributed under the BSD 3-Clause license, see LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <rapidcsv/rapidcsv.h>
+
+
+namespace rapidcsv
+{
+  /**
+   * @brief     Splits CSV text into rows and cells, same as 'Document::_parseCsv()', i.e. applying quoting,
+   *            trimming and line-break rules of the Document's 'SeparatorParams'.
+   *            Only intended for internal usage.
+   */
+  class _RowTokenizer
+  {
+  public:
+    explicit _RowTokenizer(const Document& pDocument)
+      : _mDocument(pDocument)
+    {}
+
+    /**
+     * @brief   Find the end of the row starting at 'pOffset'.
+     * @param   pData                 CSV text.
+     * @param   pOffset               offset of the first character of the row.
+     * @returns offset of the line break ending the row, or 'pData.size()' if the row is not terminated.
+     */
+    size_t findRowEnd(const std::string_view pData, const size_t pOffset) const
+    {
+      const SeparatorParams& separatorParams = _mDocument._mSeparatorParams;
+      const char* const data = pData.data();
+      const size_t size = pData.size();
+
+      if (!separatorParams.mQuotedLinebreaks)
+      {
+        const void* const lineBreak = std::memchr(data + pOffset, '\n', size - pOffset);
+        return (lineBreak != nullptr) ? static_cast<size_t>(static_cast<const char*>(lineBreak) - data) : size;
+      }
+
+      // quote state as tracked by 'Document::_parseCsv()', without building the cells.
+      bool quoted = false;
+      size_t cellLength = 0;
+      bool cellStartsWithQuote = false;
+      bool cellHasQuote = false;
+      bool cellAllSpace = true;            // all characters of cell are whitespace
+      bool cellSpaceBeforeQuote = true;    // all characters before first quote of cell are whitespace
+      for (size_t i = pOffset; i < size; ++i)
+      {
+        const char ch = data[i];
+        if (ch == separatorParams.mQuoteChar)
+        {
+          if ( (cellLength == 0) || cellStartsWithQuote ||
+               (separatorParams.mTrim && (cellHasQuote ? cellSpaceBeforeQuote : cellAllSpace)) )
+          {
+            quoted = !quoted;
+          }
+          if (!cellHasQuote)
+          {
+            cellHasQuote = true;
+            cellSpaceBeforeQuote = cellAllSpace;
+          }
+          cellStartsWithQuote = cellStartsWithQuote || (cellLength == 0);
+          cellAllSpace = false;
+          ++cellLength;
+        }
+        else if ( (ch == separatorParams.mSeparator) && !quoted )
+        {
+          cellLength = 0;
+          cellStartsWithQuote = false;
+          cellHasQuote = false;
+          cellAllSpace = true;
+          cellSpaceBeforeQuote = true;
+        }
+        else if ( ((ch == '\r') || (ch == '\n')) && !quoted )
+        {
+          if (ch == '\n')
+          {
+            return i;
+          }
+        }
+        else
+        {
+          cellAllSpace = cellAllSpace && isspace(static_cast<unsigned char>(ch));
+          ++cellLength;
+        }
+      }
+      return size;
+    }
+
+    /**
+     * @brief   Split a row into cells, appending them to 'pRow'.
+     * @param   pLine                 row text, excluding the terminating line break.
+     * @param   pRow                  cells of the row.
+     * @param   pMaxCells             maximum number of cells to be split.
+     */
+    void tokenize(const std::string_view pLine, Document::t_dataRow& pRow, const size_t pMaxCells) const
+    {
+      const SeparatorParams& separatorParams = _mDocument._mSeparatorParams;
+      std::string cell;
+      bool quoted = false;
+      for (const char ch : pLine)
+      {
+        if (ch == separatorParams.mQuoteChar)
+        {
+          if (cell.empty() || (cell[0] == separatorParams.mQuoteChar))
+          {
+            quoted = !quoted;
+          }
+          else if (separatorParams.mTrim)
+          {
+            // allow whitespace before first mQuoteChar
+            const auto firstQuote = std::find(cell.begin(), cell.end(), separatorParams.mQuoteChar);
+            if (std::all_of(cell.begin(), firstQuote, [](int c) { return isspace(c); }))
+            {
+              quoted = !quoted;
+            }
+          }
+          cell += ch;
+        }
+        else if (ch == separatorParams.mSeparator)
+        {
+          if (!quoted)
+          {
+            pRow.push_back(_mDocument._unquote(_mDocument._trim(cell)));
+            cell.clear();
+            if (pRow.size() == pMaxCells)
+            {
+              return;
+            }
+          }
+          else
+          {
+            cell += ch;
+          }
+        }
+        else if (ch == '\r')
+        {
+          if (separatorParams.mQuotedLinebreaks && quoted)
+          {
+            cell += ch;
+          }
+        }
+        else
+        {
+          // a '\n' is only within the line for quoted line breaks
+          cell += ch;
+        }
+      }
+      pRow.push_back(_mDocument._unquote(_mDocument._trim(cell)));
+    }
+
+    /**
+     * @brief   Check if a row is skipped as empty line, same as 'Document::_parseCsv()'.
+     * @param   pLine                 row text, excluding the terminating line break.
+     * @param   pIsLastLine           true if the row is not terminated by a line break.
+     * @returns true if the row is to be skipped.
+     */
+    bool isSkippedEmpty(const std::string_view pLine, const bool pIsLastLine) const
+    {
+      // unquoted CR's are not part of any cell, hence a line of only CR's is empty
+      return (pLine.find_first_not_of('\r') == std::string_view::npos) &&
+             (_mDocument._mLineReaderParams.mSkipEmptyLines || pIsLastLine);
+    }
+
+    /**
+     * @brief   Check if a row is skipped as comment line, same as 'Document::_parseCsv()'.
+     * @param   pRow                  cells of the row, at least the first cell.
+     * @returns true if the row is to be skipped.
+     */
+    bool isSkippedComment(const Document::t_dataRow& pRow) const
+    {
+      const LineReaderParams& lineReaderParams = _mDocument._mLineReaderParams;
+      return lineReaderParams.mSkipCommentLines && !pRow.empty() && !pRow.at(0).empty() &&
+             (pRow.at(0)[0] == lineReaderParams.mCommentPrefix);
+    }
+
+  private:
+    const Document& _mDocument;
+  };
+
+
+  /**
+   * @brief     Class representing a read-only CSV document, whose rows are tokenized on first access.
+   *            Loading scans the file in chunks, and records only the byte range of each data row (and the
+   *            row label, if present), applying the same quoting, line-break, comment and empty-line rules
+   *            as 'Document'. The file is kept open, and a row is read from it when it is not in the cache.
+   *            Hence memory use is proportional to the number of rows plus the cached rows, not to the
+   *            file size. Only the 'std::istream' constructor keeps the whole stream contents in memory.
+   *            Tokenized rows are kept in a bounded least-recently-used cache.
+   *            As getters update the cache, a LazyDocument must not be shared between threads.
+   *            A UTF-8 BOM is skipped, UTF-16 files are not supported.
+   */
+  class LazyDocument
+  {
+  public:
+
+    /**
+     * @brief   default number of tokenized rows kept in the cache.
+     */
+    static constexpr size_t s_DefaultCacheRowCount = 1024;
+
+    /**
+     * @brief   number of bytes read at once when scanning a CSV-file for rows.
+     */
+    static constexpr size_t s_ReadChunkSize = 1 << 20;
+
+    /**
+     * @brief   Constructor
+     * @param   pPath                 specifies the path of an existing CSV-file to populate the Document
+     *                                data with.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   pCacheRowCount        maximum number of tokenized rows kept in the cache (minimum 1).
+     */
+    explicit LazyDocument(const std::string& pPath,
+                          const LabelParams& pLabelParams = LabelParams(),
+                          const SeparatorParams& pSeparatorParams = SeparatorParams(),
+                          const LineReaderParams& pLineReaderParams = LineReaderParams(),
+                          const size_t pCacheRowCount = s_DefaultCacheRowCount)
+      : _mDocument(std::string(), pLabelParams, pSeparatorParams, pLineReaderParams)
+      , _mBuffer()
+      , _mFile()
+      , _mRowText()
+      , _mRows()
+      , _mCacheRowCount(std::max<size_t>(1, pCacheRowCount))
+      , _mCache()
+      , _mCacheOrder()
+    {
+      _mFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+      _mFile.open(pPath, std::ios::binary);
+      _mFile.exceptions(std::ifstream::badbit);    // reading up to end-of-file sets failbit
+      std::string window;
+      _scanRows(window, &_mFile);
+    }
+
+    /**
+     * @brief   Constructor
+     * @param   pStream               specifies a binary input stream to read CSV data from.
+     * @param   pLabelParams          specifies which row and column should be treated as labels.
+     * @param   pSeparatorParams      specifies which field and row separators should be used.
+     * @param   pLineReaderParams     specifies how special line formats should be treated.
+     * @param   pCacheRowCount        maximum number of tokenized rows kept in the cache (minimum 1).
+     */
+    explicit LazyDocument(std::istream& pStream,
+                          const LabelParams& pLabelParams = LabelParams(),
+                          const SeparatorParams& pSeparatorParams = SeparatorParams(),
+                          const LineReaderParams& pLineReaderParams = LineReaderParams(),
+                          const size_t pCacheRowCount = s_DefaultCacheRowCount)
+      : _mDocument(std::string(), pLabelParams, pSeparatorParams, pLineReaderParams)
+      , _mBuffer()
+      , _mFile()
+      , _mRowText()
+      , _mRows()
+      , _mCacheRowCount(std::max<size_t>(1, pCacheRowCount))
+      , _mCache()
+      , _mCacheOrder()
+    {
+      _readCsv(pStream);
+    }
+
+    /**
+     * @brief   Get column index either by it's index or name.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns zero-based column index.
+     */
+    inline size_t GetColumnIdx(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return _mDocument.GetColumnIdx(pColumnNameIdx);
+    }
+
+    /**
+     * @brief   Get row index either by it's index or name.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns zero-based row index.
+     */
+    inline size_t GetRowIdx(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return _mDocument.GetRowIdx(pRowNameIdx);
+    }
+
+    /**
+     * @brief   Get column either by it's index or name. Rows not in the cache are tokenized
+     *          without being added to it, hence a column scan does not evict cached rows.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'vector<R>' of column data. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     *          On conversion success variant has the converted value,
+     *          else the string value which caused failure during conversion.
+     */
+    template< typename T_C >
+    std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>
+    GetColumn(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> column;
+      column.reserve(_mRows.size());
+      // only split the cells up to the requested one, plus the row label
+      const size_t maxCells = columnIdx + 1 + ((_mDocument._mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT) ? 1 : 0);
+      Document::t_dataRow scratchRow;
+      for (size_t rowIdx = 0; rowIdx < _mRows.size(); ++rowIdx)
+      {
+        const auto itCache = _mCache.find(rowIdx);
+        const Document::t_dataRow* row = &scratchRow;
+        if (itCache != _mCache.end())
+        {
+          row = &(itCache->second.mRow);
+        } else {
+          _tokenizeRow(rowIdx, scratchRow, maxCells);
+        }
+
+        if (columnIdx >= row->size())
+        {
+          static const std::string errMsg("rapidcsv::LazyDocument::GetColumn() : requested column index is more than row.size()");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnNameIdx='" << pColumnNameIdx << "' , rowIdx=" << rowIdx << " , row.size()=" << row->size());
+          throw std::out_of_range(errMsg);
+        }
+        column.push_back(_S2Tdispatch<T_C>((*row)[columnIdx]));
+      }
+      return column;
+    }
+
+    /**
+     * @brief   Get column either by it's index or name.
+     * @tparam  CONV_S2T              conversion function.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'vector<R>' of column data.
+     */
+    template< auto (*CONV_S2T)(const std::string&) >
+    inline std::vector< typename converter::f_S2Tconv_c< CONV_S2T >::return_type >
+    GetColumn(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      return GetColumn< converter::f_S2Tconv_c< CONV_S2T > >(pColumnNameIdx);
+    }
+
+    /**
+     * @brief   Get row either by it's index or name.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'tuple<R...>' of row data. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename ... T_C >
+    std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+    GetRow(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      const Document::t_dataRow& rowData = _getCachedRow(GetRowIdx(pRowNameIdx), "rapidcsv::LazyDocument::GetRow()");
+
+      if( rowData.size() < sizeof...(T_C) )
+      {
+        static const std::string errMsg("rapidcsv::LazyDocument::GetRow(pRowNameIdx) :: ERROR : row-size less than tuple size");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowNameIdx='" << pRowNameIdx << "' , row-size=" << rowData.size()
+                                  << " , tuple-size=" << sizeof...(T_C) );
+        throw std::out_of_range(errMsg);
+      }
+
+      return Document::_getRow<T_C...>(rowData, std::index_sequence_for<T_C...>{});
+    }
+
+    /**
+     * @brief   Get row either by it's index or name.
+     * @tparam  CONV_S2T              conversion function of type 'R (*CONV_S2T)(const std::string&)'.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'tuple<R...>' of row data.
+     */
+    template< auto ... CONV_S2T >
+    inline std::tuple< typename converter::f_S2Tconv_c< CONV_S2T >::return_type... >
+    GetRow(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return GetRow< converter::f_S2Tconv_c< CONV_S2T >... >(pRowNameIdx);
+    }
+
+    /**
+     * @brief   Get row either by it's index or name.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'vector<std::string>' of row data
+     */
+    std::vector<std::string>
+    GetRow_VecStr(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return _getCachedRow(GetRowIdx(pRowNameIdx), "rapidcsv::LazyDocument::GetRow_VecStr()");
+    }
+
+    /**
+     * @brief   Get cell either by it's index or name.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns cell data of type R. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    typename converter::t_S2Tconv_c<T_C>::return_type
+    GetCell(const c_sizet_or_string auto& pColumnNameIdx,
+            const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      const size_t rowIdx = GetRowIdx(pRowNameIdx);
+
+      return _S2Tdispatch<T_C>(_getCachedRow(rowIdx, "rapidcsv::LazyDocument::GetCell()").at(columnIdx));
+    }
+
+    /**
+     * @brief   Get cell either by it's index or name.
+     * @tparam  CONV_S2T              conversion function.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns cell data of type R.
+     */
+    template< auto (*CONV_S2T)(const std::string&) >
+    inline typename converter::f_S2Tconv_c< CONV_S2T >::return_type
+    GetCell(const c_sizet_or_string auto& pColumnNameIdx,
+            const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      return GetCell< converter::f_S2Tconv_c< CONV_S2T > >(pColumnNameIdx, pRowNameIdx);
+    }
+
+    /**
+     * @brief   Get number of data rows (excluding label rows).
+     * @returns row count.
+     */
+    inline size_t GetRowCount() const
+    {
+      return _mRows.size();
+    }
+
+    /**
+     * @brief   Get number of data columns (excluding label columns).
+     *          Without column labels, the first data row is tokenized.
+     * @returns column count, 0 without column labels and data rows.
+     */
+    inline size_t GetColumnCount() const
+    {
+      if (_mDocument._mLabelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT)
+      {
+        return _mDocument._mIdxColumnNames.size();
+      } else if (_mRows.empty()) {
+        return 0;
+      } else {
+        return _getCachedRow(0, "rapidcsv::LazyDocument::GetColumnCount()").size();
+      }
+    }
+
+    /**
+     * @brief   Get number of tokenized rows currently held in the cache.
+     * @returns cached row count.
+     */
+    inline size_t GetCachedRowCount() const
+    {
+      return _mCache.size();
+    }
+
+    /**
+     * @brief   Get column name
+     * @param   pColumnIdx            zero-based column index.
+     * @returns column name.
+     */
+    inline std::string GetColumnName(const size_t pColumnIdx) const
+    {
+      return _mDocument.GetColumnName(pColumnIdx);
+    }
+
+    /**
+     * @brief   Get column names
+     * @returns vector of column names.
+     */
+    inline std::vector<std::string> GetColumnNames() const
+    {
+      return _mDocument.GetColumnNames();
+    }
+
+    /**
+     * @brief   Get row name
+     * @param   pRowIdx               zero-based row index.
+     * @returns row name.
+     */
+    inline std::string GetRowName(const size_t pRowIdx) const
+    {
+      return _mDocument.GetRowName(pRowIdx);
+    }
+
+    /**
+     * @brief   Get row names
+     * @returns vector of row names.
+     */
+    inline std::vector<std::string> GetRowNames() const
+    {
+      return _mDocument.GetRowNames();
+    }
+
+    /**
+     * @brief   Convert to a row-major Document, tokenizing all rows. The cache is left unchanged.
+     * @returns Document with copy of data and labels.
+     */
+    Document ToDocument() const
+    {
+      Document document(_mDocument);
+      document._mData.resize(_mRows.size());
+      for (size_t rowIdx = 0; rowIdx < _mRows.size(); ++rowIdx)
+      {
+        _tokenizeRow(rowIdx, document._mData[rowIdx]);
+      }
+      return document;
+    }
+
+  private:
+    // byte range of a data row in the CSV-file or '_mBuffer', excluding the line break.
+    struct _RowSpan
+    {
+      size_t mOffset;
+      size_t mLength;
+    };
+
+    struct _CacheEntry
+    {
+      Document::t_dataRow               mRow;
+      std::list<size_t>::iterator       mOrderIt;
+
+      _CacheEntry()
+        : mRow(), mOrderIt()
+      {}
+    };
+
+    void _readCsv(std::istream& pStream)
+    {
+      pStream.seekg(0, std::ios::end);
+      const std::streamsize length = pStream.tellg();
+      pStream.seekg(0, std::ios::beg);
+
+      _mBuffer.resize(static_cast<size_t>(std::max<std::streamsize>(length, 0)));
+      pStream.read(_mBuffer.data(), static_cast<std::streamsize>(_mBuffer.size()));
+      // With user-specified istream opened in non-binary mode on windows, less data may be read.
+      _mBuffer.resize(static_cast<size_t>(pStream.gcount()));
+
+      _scanRows(_mBuffer, nullptr);
+    }
+
+    // records the byte range of each data row. With 'pChunkSource', 'pWindow' holds only the data not scanned
+    // yet, and is refilled from it in chunks of 's_ReadChunkSize'; else 'pWindow' holds the whole contents.
+    void _scanRows(std::string& pWindow, std::istream* pChunkSource)
+    {
+      size_t windowOffset = 0;                  // offset of 'pWindow[0]' in the CSV data
+      bool isEnd = (pChunkSource == nullptr);   // true when 'pWindow' holds all remaining data
+      // drops the scanned data before 'pPos' and appends the next chunk, returns the new position of 'pPos'.
+      auto readChunk = [&](const size_t pPos) -> size_t
+      {
+        pWindow.erase(0, pPos);
+        windowOffset += pPos;
+        const size_t size = pWindow.size();
+        pWindow.resize(size + s_ReadChunkSize);
+        pChunkSource->read(pWindow.data() + size, static_cast<std::streamsize>(s_ReadChunkSize));
+        const size_t count = static_cast<size_t>(pChunkSource->gcount());
+        pWindow.resize(size + count);
+        isEnd = (count < s_ReadChunkSize);
+        return 0;
+      };
+
+      size_t pos = 0;
+      if (!isEnd)
+      {
+        pos = readChunk(pos);
+      }
+      if (std::string_view(pWindow).starts_with(std::string_view(s_Utf8BOM.data(), s_Utf8BOM.size())))
+      {
+        pos = s_Utf8BOM.size();
+        _mDocument._mHasUtf8BOM = true;
+      }
+
+      const LabelParams& labelParams = _mDocument._mLabelParams;
+      const bool columnNamesPresent = (labelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT);
+      const bool rowNamesPresent = (labelParams.mRowNameFlg == FlgRowName::RN_PRESENT);
+      const bool needFirstCell = rowNamesPresent || _mDocument._mLineReaderParams.mSkipCommentLines;
+
+      bool headerPending = columnNamesPresent || rowNamesPresent;
+      const _RowTokenizer tokenizer(_mDocument);
+      Document::t_dataRow cells;
+      size_t cr = 0;
+      size_t lf = 0;
+      while (true)
+      {
+        if (pos >= pWindow.size())
+        {
+          if (isEnd)
+          {
+            break;
+          }
+          pos = readChunk(pos);
+          continue;
+        }
+
+        const size_t lineEnd = tokenizer.findRowEnd(pWindow, pos);
+        if ((lineEnd == pWindow.size()) && !isEnd)
+        {
+          // the row may continue in the next chunk
+          pos = readChunk(pos);
+          continue;
+        }
+
+        const std::string_view line(pWindow.data() + pos, lineEnd - pos);
+        const size_t lineOffset = windowOffset + pos;
+        if (lineEnd < pWindow.size())
+        {
+          ++lf;
+          if (!line.empty() && (line.back() == '\r'))
+          {
+            ++cr;
+          }
+        }
+        pos = lineEnd + 1;
+
+        if (tokenizer.isSkippedEmpty(line, (lineEnd == pWindow.size())))
+        {
+          continue;
+        }
+
+        cells.clear();
+        if (headerPending)
+        {
+          tokenizer.tokenize(line, cells, std::string_view::npos);
+        } else if (needFirstCell) {
+          tokenizer.tokenize(line, cells, 1);
+        }
+
+        if (tokenizer.isSkippedComment(cells))
+        {
+          continue;
+        }
+
+        if (headerPending)
+        {
+          headerPending = false;
+          if (columnNamesPresent)
+          {
+            if (rowNamesPresent)
+            {
+              _mDocument._mFirstCornerCell = cells.at(0);
+              cells.erase(cells.begin());
+            }
+            _mDocument._mIdxColumnNames = cells;
+            continue;
+          }
+        }
+
+        _mRows.push_back(_RowSpan{ lineOffset, line.size() });
+        if (rowNamesPresent)
+        {
+          _mDocument._mIdxRowNames.push_back(cells.at(0));
+        }
+      }
+
+      // Assume CR/LF if at least half the linebreaks have CR
+      _mDocument._mSeparatorParams.mHasCR = (cr > (lf / 2));
+
+      _mDocument._updateColumnNames("rapidcsv::LazyDocument::_scanRows()");
+      _mDocument._updateRowNames("rapidcsv::LazyDocument::_scanRows()");
+    }
+
+    // text of a data row, excluding the line break. Read from the CSV-file, unless created from a stream.
+    std::string_view _getRowText(const size_t pRowIdx) const
+    {
+      const _RowSpan& span = _mRows[pRowIdx];
+      if (!_mFile.is_open())
+      {
+        return std::string_view(_mBuffer.data() + span.mOffset, span.mLength);
+      }
+
+      _mRowText.resize(span.mLength);
+      _mFile.clear();
+      _mFile.seekg(static_cast<std::streamoff>(span.mOffset));
+      _mFile.read(_mRowText.data(), static_cast<std::streamsize>(span.mLength));
+      if (static_cast<size_t>(_mFile.gcount()) != span.mLength)
+      {
+        static const std::string errMsg("rapidcsv::LazyDocument::_getRowText() : CSV-file is shorter than when it was loaded");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowIdx=" << pRowIdx << " , offset=" << span.mOffset << " , length=" << span.mLength);
+        throw std::out_of_range(errMsg);
+      }
+      return _mRowText;
+    }
+
+    void _tokenizeRow(const size_t pRowIdx, Document::t_dataRow& pRow,
+                      const size_t pMaxCells = std::string_view::npos) const
+    {
+      pRow.clear();
+      _RowTokenizer(_mDocument).tokenize(_getRowText(pRowIdx), pRow, pMaxCells);
+      if (_mDocument._mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
+      {
+        pRow.erase(pRow.begin()); // remove row-header from datas
+      }
+    }
+
+    // returns the tokenized row from the cache, tokenizing it on a miss and evicting the least recently used row.
+    const Document::t_dataRow& _getCachedRow(const size_t pRowIdx, [[maybe_unused]] const std::string& calleeFunction) const
+    {
+      if (pRowIdx >= _mRows.size())
+      {
+        static const std::string errMsg("rapidcsv::LazyDocument::_getCachedRow() : row not found");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowIdx=" << pRowIdx << " calleeFunction='" << calleeFunction << "'");
+        throw std::out_of_range(errMsg);
+      }
+
+      const auto itCache = _mCache.find(pRowIdx);
+      if (itCache != _mCache.end())
+      {
+        _mCacheOrder.splice(_mCacheOrder.begin(), _mCacheOrder, itCache->second.mOrderIt);
+        return itCache->second.mRow;
+      }
+
+      Document::t_dataRow row;
+      if (_mCache.size() >= _mCacheRowCount)
+      {
+        // reuse the evicted row's storage
+        auto itEvict = _mCache.find(_mCacheOrder.back());
+        row.swap(itEvict->second.mRow);
+        _mCache.erase(itEvict);
+        _mCacheOrder.pop_back();
+      }
+      _tokenizeRow(pRowIdx, row);
+
+      _mCacheOrder.push_front(pRowIdx);
+      _CacheEntry& entry = _mCache[pRowIdx];
+      entry.mRow.swap(row);
+      entry.mOrderIt = _mCacheOrder.begin();
+      return entry.mRow;
+    }
+
+    Document                  _mDocument;   // holds labels and file-format details, its '_mData' is kept empty
+    std::string               _mBuffer;     // whole stream contents, for the 'std::istream' constructor only
+    mutable std::ifstream     _mFile;       // CSV-file, for the file constructor; rows are read from it on access
+    mutable std::string       _mRowText;    // text of the row last read from '_mFile'
+    std::vector<_RowSpan>     _mRows;
+    const size_t              _mCacheRowCount;
+    mutable std::unordered_map<size_t, _CacheEntry> _mCache;
+    mutable std::list<size_t>                        _mCacheOrder;   // most recently used first
+  };
+}
@@ -25,6 +25,10 @@
 #pragma once
 
 #include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <compare>
+#include <cstdint>
 
 #ifdef HAS_CODECVT
 #include <codecvt>
@@ -32,10 +36,21 @@
 #endif
 
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <map>
+#include <array>
+#include <span>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <system_error>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <cassert>
 
@@ -241,9 +256,855 @@ namespace rapidcsv
    */
   template <typename SI>
   concept c_sizet_or_string = std::is_convertible_v<SI,size_t> ||
-                              std::is_convertible_v<SI,std::string>;
+                              std::is_convertible_v<SI,std::string> ||
+                              std::is_convertible_v<SI,std::string_view>;
 
 
+  /**
+   * @brief     Open-addressing (linear probing) hash index, mapping label-names to their zero-based index.
+   *            The label strings are not duplicated : slots hold only the label-index (and it's hash),
+   *            the strings are looked up from the label vector passed to each call.
+   *            Lookup is by 'std::string_view', hence no temporary 'std::string' is needed.
+   */
+  class _LabelIndex
+  {
+  public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    _LabelIndex()
+      : _mSlots()
+      , _mSize(0)
+    {}
+
+    /**
+     * @brief   Find the index of a label.
+     * @param   pLabel                label-name to search.
+     * @param   pLabels               label vector, indexed by label-index.
+     * @returns zero-based label-index if found, else '_LabelIndex::npos'.
+     */
+    size_t find(const std::string_view pLabel, const std::vector<std::string>& pLabels) const
+    {
+      if (_mSize == 0)
+      {
+        return npos;
+      }
+
+      const size_t hash = _hash(pLabel);
+      const size_t mask = _mSlots.size() - 1;
+      for (size_t pos = hash & mask; _mSlots[pos].mIdx != npos; pos = (pos + 1) & mask)
+      {
+        if ( (_mSlots[pos].mHash == hash) &&
+             (std::string_view(pLabels[_mSlots[pos].mIdx]) == pLabel) )
+        {
+          return _mSlots[pos].mIdx;
+        }
+      }
+      return npos;
+    }
+
+    /**
+     * @brief   Add label 'pLabels[pIdx]' to the index.
+     * @param   pIdx                  zero-based label-index.
+     * @param   pLabels               label vector, indexed by label-index.
+     * @returns false if the label already exists (index is unchanged), else true.
+     */
+    bool insert(const size_t pIdx, const std::vector<std::string>& pLabels)
+    {
+      if (((_mSize + 1) * 2) > _mSlots.size())
+      {
+        _rehash(std::max<size_t>(16, _mSlots.size() * 2));
+      }
+
+      const std::string_view label(pLabels[pIdx]);
+      const size_t hash = _hash(label);
+      const size_t mask = _mSlots.size() - 1;
+      size_t pos = hash & mask;
+      for (; _mSlots[pos].mIdx != npos; pos = (pos + 1) & mask)
+      {
+        if ( (_mSlots[pos].mHash == hash) &&
+             (std::string_view(pLabels[_mSlots[pos].mIdx]) == label) )
+        {
+          return false;
+        }
+      }
+      _mSlots[pos] = _Slot{ hash, pIdx };
+      ++_mSize;
+      return true;
+    }
+
+    /**
+     * @brief   Remove a label from the index. Uses backward-shift deletion, hence no tombstones.
+     * @param   pLabel                label-name to remove.
+     * @param   pLabels               label vector, indexed by label-index.
+     */
+    void erase(const std::string_view pLabel, const std::vector<std::string>& pLabels)
+    {
+      if (_mSize == 0)
+      {
+        return;
+      }
+
+      const size_t hash = _hash(pLabel);
+      const size_t mask = _mSlots.size() - 1;
+      size_t pos = hash & mask;
+      for (; _mSlots[pos].mIdx != npos; pos = (pos + 1) & mask)
+      {
+        if ( (_mSlots[pos].mHash == hash) &&
+             (std::string_view(pLabels[_mSlots[pos].mIdx]) == pLabel) )
+        {
+          break;
+        }
+      }
+      if (_mSlots[pos].mIdx == npos)
+      {
+        return;
+      }
+
+      // shift back subsequent entries of the probe-chain, that are not at their home slot
+      size_t hole = pos;
+      for (size_t next = (hole + 1) & mask; _mSlots[next].mIdx != npos; next = (next + 1) & mask)
+      {
+        const size_t home = _mSlots[next].mHash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+          _mSlots[hole] = _mSlots[next];
+          hole = next;
+        }
+      }
+      _mSlots[hole] = _Slot{ 0, npos };
+      --_mSize;
+    }
+
+    /**
+     * @brief   Adjust label-index of all labels with index >= 'pFromIdx' by 'pDelta'.
+     *          Used when rows/columns are inserted or removed.
+     * @param   pFromIdx              first label-index to be adjusted.
+     * @param   pDelta                offset to be added to the label-index.
+     */
+    void shift(const size_t pFromIdx, const ssize_t pDelta)
+    {
+      for (auto& slot : _mSlots)
+      {
+        if ((slot.mIdx != npos) && (slot.mIdx >= pFromIdx))
+        {
+          slot.mIdx = static_cast<size_t>(static_cast<ssize_t>(slot.mIdx) + pDelta);
+        }
+      }
+    }
+
+    void clear()
+    {
+      _mSlots.clear();
+      _mSize = 0;
+    }
+
+    size_t size() const
+    {
+      return _mSize;
+    }
+
+  private:
+    struct _Slot
+    {
+      size_t mHash = 0;
+      size_t mIdx  = npos;
+    };
+
+    static size_t _hash(const std::string_view pLabel)
+    {
+      return std::hash<std::string_view>{}(pLabel);
+    }
+
+    void _rehash(const size_t pCapacity)
+    {
+      std::vector<_Slot> slots(pCapacity);
+      const size_t mask = pCapacity - 1;
+      for (auto& slot : _mSlots)
+      {
+        if (slot.mIdx != npos)
+        {
+          size_t pos = slot.mHash & mask;
+          while (slots[pos].mIdx != npos)
+          {
+            pos = (pos + 1) & mask;
+          }
+          slots[pos] = slot;
+        }
+      }
+      _mSlots.swap(slots);
+    }
+
+    std::vector<_Slot> _mSlots;   // capacity is always a power of 2
+    size_t _mSize;
+  };
+
+
+  /**
+   * @brief     Number of days since 1970-01-01 of a (proleptic Gregorian) civil date.
+   * @param     pYear               year.
+   * @param     pMonth              month [1, 12].
+   * @param     pDay                day [1, 31].
+   * @returns   day count, negative for dates before 1970-01-01.
+   */
+  constexpr int32_t DaysFromCivil(int32_t pYear, const unsigned pMonth, const unsigned pDay) noexcept
+  {
+    // http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+    pYear -= (pMonth <= 2) ? 1 : 0;
+    const int32_t era = (pYear >= 0 ? pYear : pYear - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(pYear - era * 400);                      // [0, 399]
+    const unsigned doy = (153 * (pMonth > 2 ? pMonth - 3 : pMonth + 9) + 2) / 5 + pDay - 1;  // [0, 365]
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                         // [0, 146096]
+    return era * 146097 + static_cast<int32_t>(doe) - 719468;
+  }
+
+  /**
+   * @brief     Convert a day count (days since 1970-01-01) to 'std::chrono::year_month_day'.
+   * @param     pDays               day count, as returned by 'DaysFromCivil()' or 'ParseISODate()'.
+   * @returns   calendar date.
+   */
+  inline std::chrono::year_month_day ToYearMonthDay(const int32_t pDays)
+  {
+    return std::chrono::year_month_day{ std::chrono::sys_days{ std::chrono::days{ pDays } } };
+  }
+
+  /*
+   *  Parses exactly 'YYYY-MM-DD'. All digits are checked together (no early exit per character),
+   *  no locale and no stream is involved. Returns false on any deviation, or an invalid date.
+   */
+  inline bool _parseISODate(const std::string_view pStr, int32_t& pYear, unsigned& pMonth, unsigned& pDay) noexcept
+  {
+    if ( (pStr.size() != 10) || (pStr[4] != '-') || (pStr[7] != '-') )
+    {
+      return false;
+    }
+
+    const auto digit = [&pStr](const size_t pos) -> unsigned
+                       { return static_cast<unsigned>(static_cast<unsigned char>(pStr[pos])) - unsigned('0'); };
+    const unsigned y0 = digit(0), y1 = digit(1), y2 = digit(2), y3 = digit(3);
+    const unsigned m0 = digit(5), m1 = digit(6), d0 = digit(8), d1 = digit(9);
+    // a non-digit character wraps around to a value > 9 ; bitwise '|' to avoid a branch per character
+    if ( (y0 > 9) | (y1 > 9) | (y2 > 9) | (y3 > 9) | (m0 > 9) | (m1 > 9) | (d0 > 9) | (d1 > 9) )
+    {
+      return false;
+    }
+
+    const unsigned year = y0 * 1000 + y1 * 100 + y2 * 10 + y3;
+    pMonth = m0 * 10 + m1;
+    pDay   = d0 * 10 + d1;
+    if ( (pMonth < 1) || (pMonth > 12) || (pDay < 1) )
+    {
+      return false;
+    }
+
+    static constexpr unsigned char daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    const bool isLeap = ( (year % 4) == 0 ) && ( ( (year % 100) != 0 ) || ( (year % 400) == 0 ) );
+    const unsigned lastDay = unsigned(daysInMonth[pMonth - 1]) + ( (pMonth == 2 && isLeap) ? 1u : 0u );
+    if (pDay > lastDay)
+    {
+      return false;
+    }
+
+    pYear = static_cast<int32_t>(year);
+    return true;
+  }
+
+  /**
+   * @brief     Parse an ISO-8601 date 'YYYY-MM-DD' to a day count (days since 1970-01-01).
+   *            The date is validated, e.g. '2023-02-29' is rejected.
+   * @param     pStr                date string.
+   * @param     pDays               day count, set only on success.
+   * @returns   true on success.
+   */
+  inline bool ParseISODate(const std::string_view pStr, int32_t& pDays) noexcept
+  {
+    int32_t year;
+    unsigned month, day;
+    if (!_parseISODate(pStr, year, month, day))
+    {
+      return false;
+    }
+    pDays = DaysFromCivil(year, month, day);
+    return true;
+  }
+
+  /**
+   * @brief     Parse an ISO-8601 timestamp to seconds since 1970-01-01T00:00:00.
+   *            Accepted formats are 'YYYY-MM-DD', 'YYYY-MM-DDThh:mm:ss' and 'YYYY-MM-DD hh:mm:ss',
+   *            each optionally followed by 'Z'.
+   * @param     pStr                timestamp string.
+   * @param     pSeconds            seconds count, set only on success.
+   * @returns   true on success.
+   */
+  inline bool ParseISOTimestamp(std::string_view pStr, int64_t& pSeconds) noexcept
+  {
+    if (!pStr.empty() && pStr.back() == 'Z')
+    {
+      pStr.remove_suffix(1);
+    }
+
+    int32_t days;
+    if (!ParseISODate(pStr.substr(0, 10), days))
+    {
+      return false;
+    }
+    int64_t seconds = int64_t(days) * 86400;
+    if (pStr.size() == 10)
+    {
+      pSeconds = seconds;
+      return true;
+    }
+
+    if ( (pStr.size() != 19) || ((pStr[10] != 'T') && (pStr[10] != ' ')) ||
+         (pStr[13] != ':') || (pStr[16] != ':') )
+    {
+      return false;
+    }
+    const auto twoDigits = [&pStr](const size_t pos) -> unsigned
+    {
+      const unsigned tens = static_cast<unsigned>(static_cast<unsigned char>(pStr[pos])) - unsigned('0');
+      const unsigned ones = static_cast<unsigned>(static_cast<unsigned char>(pStr[pos+1])) - unsigned('0');
+      return (tens > 9 || ones > 9) ? 100 : tens * 10 + ones;
+    };
+    const unsigned hh = twoDigits(11), mm = twoDigits(14), ss = twoDigits(17);
+    if ( (hh > 23) || (mm > 59) || (ss > 59) )
+    {
+      return false;
+    }
+    pSeconds = seconds + int64_t(hh * 3600 + mm * 60 + ss);
+    return true;
+  }
+
+  /**
+   * @brief     Conversion class (satisfies concept 'c_S2Tconverter') of an ISO-8601 date 'YYYY-MM-DD'
+   *            to a compact 'int32_t' day count (days since 1970-01-01). Use it as template parameter of
+   *            'GetColumn<>', 'GetCell<>', 'SortParams<>' etc; the day counts compare in date order.
+   */
+  struct ConvertFromStr_ISODate
+  {
+    /**
+     * @brief       day count type.
+     */
+    using value_type  = int32_t;
+    /**
+     * @brief       day count type.
+     */
+    using return_type = int32_t;
+
+    /**
+     * @brief   Convert an ISO-8601 date string to day count.
+     * @param   pStr                  date string 'YYYY-MM-DD'.
+     * @returns days since 1970-01-01. Throws 'std::invalid_argument' on an invalid date.
+     */
+    static return_type ToVal(const std::string& pStr)
+    {
+      int32_t days;
+      if (!ParseISODate(pStr, days))
+      {
+        static const std::string errMsg("rapidcsv::ConvertFromStr_ISODate::ToVal() : not a valid 'YYYY-MM-DD' date");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pStr='" << pStr << "'");
+        throw std::invalid_argument(errMsg);
+      }
+      return days;
+    }
+  };
+
+  /**
+   * @brief     Conversion class (satisfies concept 'c_S2Tconverter') of an ISO-8601 timestamp
+   *            (see 'ParseISOTimestamp()') to 'int64_t' seconds since 1970-01-01T00:00:00.
+   */
+  struct ConvertFromStr_ISOTimestamp
+  {
+    /**
+     * @brief       seconds count type.
+     */
+    using value_type  = int64_t;
+    /**
+     * @brief       seconds count type.
+     */
+    using return_type = int64_t;
+
+    /**
+     * @brief   Convert an ISO-8601 timestamp string to seconds count.
+     * @param   pStr                  timestamp string.
+     * @returns seconds since 1970-01-01T00:00:00. Throws 'std::invalid_argument' on an invalid timestamp.
+     */
+    static return_type ToVal(const std::string& pStr)
+    {
+      int64_t seconds;
+      if (!ParseISOTimestamp(pStr, seconds))
+      {
+        static const std::string errMsg("rapidcsv::ConvertFromStr_ISOTimestamp::ToVal() : not a valid ISO-8601 timestamp");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pStr='" << pStr << "'");
+        throw std::invalid_argument(errMsg);
+      }
+      return seconds;
+    }
+  };
+
+
+  /*
+   *  Arithmetic types which can be parsed by 'std::from_chars'. Character types are excluded,
+   *  as converter library treats them as characters and not as numbers.
+   */
+  template <typename T>
+  concept c_fromchars_type = ( std::is_integral_v<T> &&
+                               !std::is_same_v<T, bool> &&
+                               !std::is_same_v<T, char> &&
+                               !std::is_same_v<T, signed char> &&
+                               !std::is_same_v<T, unsigned char> &&
+                               !std::is_same_v<T, wchar_t> &&
+                               !std::is_same_v<T, char8_t> &&
+                               !std::is_same_v<T, char16_t> &&
+                               !std::is_same_v<T, char32_t> )
+#if USE_FLOATINGPOINT_FROM_CHARS_1  ==  e_ENABLE_FEATURE
+                             || std::is_floating_point_v<T>
+#endif
+                             ;
+
+  /*
+   *  Identifies string-to-numeric converters of converter library, for which 'std::from_chars' gives
+   *  the same value on a successful conversion, i.e. the default converter 'ConvertFromStr<T>'
+   *  and 'ConvertFromStr<T, S2T_Format_std_CtoT/StoT<T, FailureS2Tprocess>>' (incl. NaN variants).
+   */
+  template <typename C>
+  struct _isFromCharsS2T : std::false_type {};
+
+  template <c_fromchars_type T>
+  struct _isFromCharsS2T< converter::ConvertFromStr<T> > : std::true_type {};
+
+  template <c_fromchars_type T, converter::FailureS2Tprocess P>
+  requires (!std::is_same_v< converter::ConvertFromStr<T>,
+                             converter::ConvertFromStr<T, converter::S2T_Format_std_CtoT<T, P>> >)
+  struct _isFromCharsS2T< converter::ConvertFromStr<T, converter::S2T_Format_std_CtoT<T, P>> > : std::true_type {};
+
+  template <c_fromchars_type T, converter::FailureS2Tprocess P>
+  requires (!std::is_same_v< converter::ConvertFromStr<T>,
+                             converter::ConvertFromStr<T, converter::S2T_Format_std_StoT<T, P>> >)
+  struct _isFromCharsS2T< converter::ConvertFromStr<T, converter::S2T_Format_std_StoT<T, P>> > : std::true_type {};
+
+  /*
+   *  Identifies the 'year_month_day' converter of converter library with ISO-8601 format ("%F" or "%Y-%m-%d"),
+   *  for which '_parseISODate()' gives the same date on a successful parse.
+   */
+  template <typename C>
+  struct _isISODateS2T : std::false_type {};
+
+  template <const char* FMT>
+  struct _isISODateS2T< converter::ConvertFromStr<std::chrono::year_month_day, converter::S2T_Format_StreamYMD<FMT>> >
+    : std::bool_constant< std::string_view(FMT) == "%F" || std::string_view(FMT) == "%Y-%m-%d" > {};
+
+  /**
+   * @brief     Convert a cell to type R, via conversion class 'converter::t_S2Tconv_c<T_C>'.
+   *            For arithmetic converters of converter library, the cell is first parsed with 'std::from_chars'
+   *            (no locale, no allocation), and for ISO-8601 'year_month_day' converter with '_parseISODate()'.
+   *            Only if the whole cell is not consumed successfully, the conversion falls back to the converter,
+   *            hence error/NaN behaviour is unchanged.
+   * @tparam    T_C                 T can be data-type such as int, double etc ;   xOR
+   *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   * @param     pCell               cell string.
+   * @returns   cell data of type R.
+   */
+  template< typename T_C >
+  inline typename converter::t_S2Tconv_c<T_C>::return_type
+  _S2Tdispatch(const std::string& pCell)
+  {
+    using t_S2Tconv = converter::t_S2Tconv_c<T_C>;
+    if constexpr (_isFromCharsS2T<t_S2Tconv>::value)
+    {
+      typename t_S2Tconv::value_type val;
+      const char* const last = pCell.data() + pCell.size();
+      const std::from_chars_result result = std::from_chars(pCell.data(), last, val);
+      if ( (result.ec == std::errc()) && (result.ptr == last) )
+      {
+        return typename t_S2Tconv::return_type(val);
+      }
+    } else if constexpr (_isISODateS2T<t_S2Tconv>::value) {
+      int32_t year;
+      unsigned month, day;
+      if (_parseISODate(pCell, year, month, day))
+      {
+        return typename t_S2Tconv::return_type(std::chrono::year_month_day{ std::chrono::year{ year },
+                                                                            std::chrono::month{ month },
+                                                                            std::chrono::day{ day } });
+      }
+    }
+    return t_S2Tconv::ToVal(pCell);
+  }
+
+  /*
+   *  Writes 'pVal' as 'YYYY-MM-DD' into 'pStr'. Returns false (and leaves 'pStr' unchanged) for an invalid date
+   *  or a year outside [0, 9999], which are left to the converter.
+   */
+  inline bool _writeISODate(const std::chrono::year_month_day& pVal, std::string& pStr)
+  {
+    const int year = int(pVal.year());
+    if ( !pVal.ok() || (year < 0) || (year > 9999) )
+    {
+      return false;
+    }
+    const unsigned uYear = static_cast<unsigned>(year);
+    const unsigned month = unsigned(pVal.month());
+    const unsigned day = unsigned(pVal.day());
+    const char buf[10] = { char('0' + uYear / 1000), char('0' + (uYear / 100) % 10),
+                           char('0' + (uYear / 10) % 10), char('0' + uYear % 10), '-',
+                           char('0' + month / 10), char('0' + month % 10), '-',
+                           char('0' + day / 10), char('0' + day % 10) };
+    pStr.assign(buf, sizeof(buf));
+    return true;
+  }
+
+  /**
+   * @brief     Conversion class (satisfies concept 'c_T2Sconverter') using 'std::to_chars'. Integers are
+   *            written same as 'std::to_string', floating-point values in shortest round-trip representation
+   *            (e.g. 0.1 -> "0.1"), and 'std::chrono::year_month_day' as 'YYYY-MM-DD'. No locale is used.
+   *            In addition to 'ToStr()', it has 'WriteStr()' which overwrites an existing string, retaining it's capacity.
+   * @tparam    T                   arithmetic type or 'std::chrono::year_month_day'.
+   */
+  template< typename T >
+  struct ConvertFromVal_ToChars
+  {
+    /**
+     * @brief       type of value to be converted.
+     */
+    using value_type = T;
+    /**
+     * @brief       type of value to be converted.
+     */
+    using input_type = T;
+
+    /**
+     * @brief   Convert a value to string.
+     * @param   pVal                  value to be converted.
+     * @returns string representation of 'pVal'.
+     */
+    static std::string ToStr(const input_type& pVal)
+    {
+      std::string str;
+      WriteStr(pVal, str);
+      return str;
+    }
+
+    /**
+     * @brief   Convert a value to string, overwriting the contents of 'pStr'.
+     * @param   pVal                  value to be converted.
+     * @param   pStr                  output string. It's allocated storage is reused.
+     */
+    static void WriteStr(const input_type& pVal, std::string& pStr)
+    {
+      if constexpr (std::is_same_v<T, std::chrono::year_month_day>)
+      {
+        if (!_writeISODate(pVal, pStr))
+        {
+          pStr = converter::ConvertFromVal<T>::ToStr(pVal);
+        }
+      } else if constexpr (std::is_floating_point_v<T>) {
+#if USE_FLOATINGPOINT_FROM_CHARS_1  ==  e_ENABLE_FEATURE
+        // floating-point 'std::to_chars' is available on same compilers as floating-point 'std::from_chars'
+        char buf[64];
+        const std::to_chars_result result = std::to_chars(buf, buf + sizeof(buf), pVal);
+        pStr.assign(buf, result.ptr);
+#else
+        std::ostringstream oss;
+        oss.imbue(std::locale::classic());
+        oss << std::setprecision(std::numeric_limits<T>::max_digits10) << pVal;
+        pStr = oss.str();
+#endif
+      } else {
+        static_assert(std::is_integral_v<T>, "ConvertFromVal_ToChars<T> : T must be arithmetic or 'std::chrono::year_month_day'");
+        char buf[std::numeric_limits<T>::digits10 + 3];
+        const std::to_chars_result result = std::to_chars(buf, buf + sizeof(buf), pVal);
+        pStr.assign(buf, result.ptr);
+      }
+    }
+  };
+
+  /*
+   *  Identifies converters of converter library whose output is same as 'ConvertFromVal_ToChars', i.e.
+   *  default integer conversion (locale independent, same as 'std::to_string') and 'year_month_day'
+   *  conversion with ISO-8601 format.
+   */
+  template <typename C>
+  struct _isToCharsT2S : std::false_type {};
+
+  template <c_fromchars_type T>
+  requires std::is_integral_v<T>
+  struct _isToCharsT2S< converter::ConvertFromVal<T> > : std::true_type {};
+
+  template <const char* FMT>
+  struct _isToCharsT2S< converter::ConvertFromVal<std::chrono::year_month_day, converter::T2S_Format_StreamYMD<FMT>> >
+    : std::bool_constant< std::string_view(FMT) == "%F" || std::string_view(FMT) == "%Y-%m-%d" > {};
+
+  /**
+   * @brief     Convert a value to string via conversion class 'converter::t_T2Sconv_c<T_C>', writing into existing
+   *            cell storage. Conversion classes having 'WriteStr()' (e.g. 'ConvertFromVal_ToChars') write directly,
+   *            default integer and ISO-8601 date conversions are done with 'ConvertFromVal_ToChars'.
+   * @tparam    T_C                 T can be data-type such as int, double etc ;   xOR
+   *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+   * @param     pVal                value to be converted.
+   * @param     pCell               cell string, overwritten.
+   */
+  template< typename T_C >
+  inline void
+  _T2Sdispatch(const typename converter::t_T2Sconv_c<T_C>::input_type& pVal, std::string& pCell)
+  {
+    using t_T2Sconv = converter::t_T2Sconv_c<T_C>;
+    if constexpr (requires { t_T2Sconv::WriteStr(pVal, pCell); })
+    {
+      t_T2Sconv::WriteStr(pVal, pCell);
+    } else if constexpr (_isToCharsT2S<t_T2Sconv>::value) {
+      if constexpr (std::is_same_v<typename t_T2Sconv::value_type, std::chrono::year_month_day>)
+      {
+        if (!_writeISODate(pVal, pCell))
+        {
+          pCell = t_T2Sconv::ToStr(pVal);
+        }
+      } else {
+        ConvertFromVal_ToChars<typename t_T2Sconv::value_type>::WriteStr(pVal, pCell);
+      }
+    } else {
+      pCell = t_T2Sconv::ToStr(pVal);
+    }
+  }
+
+
+  /**
+   * @brief     Lightweight proxy of a data row, as yielded by 'RowRange'. Refers to the row of the Document,
+   *            hence valid until the Document's structure changes, i.e. insert/remove of rows or columns,
+   *            Clear() or Load(). Supports structured bindings, i.e. 'auto [c0, c1] = rowProxy'.
+   * @tparam    T_C                   one for each of the first columns of the row, for typed access by 'get<I>()'.
+   *                                  T can be data-type such as int, double etc ;   xOR
+   *                                  C -> Conversion class satisfying concept 'c_S2Tconverter'.
+   */
+  template< typename ... T_C >
+  class RowProxy
+  {
+  public:
+    /**
+     * @brief   type of cell data of column 'I', as returned by 'get<I>()'.
+     */
+    template< size_t I >
+    using t_cell = typename converter::t_S2Tconv_c<std::tuple_element_t<I, std::tuple<T_C ...>>>::return_type;
+
+    RowProxy(const std::vector<std::string>& pRow, const size_t pRowIdx)
+      : _mRow(&pRow)
+      , _mRowIdx(pRowIdx)
+    {}
+
+    /**
+     * @brief   Get typed cell of column 'I'.
+     * @tparam  I                     zero-based column-index, less than number of 'T_C'.
+     * @returns cell data of type R. By default, R is usually same type as T.
+     *          If the row has no column 'I', then 'out_of_range' error is thrown.
+     */
+    template< size_t I >
+    t_cell<I> get() const
+    {
+      static_assert(I < sizeof...(T_C), "column index should be less than number of types of RowProxy");
+      if (I >= _mRow->size())
+      {
+        static const std::string errMsg("rapidcsv::RowProxy::get() : requested column index is more than row.size()");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : I=" << I << " , rowIdx=" << _mRowIdx << " , row.size()=" << _mRow->size());
+        throw std::out_of_range(errMsg);
+      }
+      return _S2Tdispatch<std::tuple_element_t<I, std::tuple<T_C ...>>>((*_mRow)[I]);
+    }
+
+    /**
+     * @brief   Get cell of the row, without any validation.
+     * @param   pColumnIdx            zero-based column-index.
+     * @returns cell data, valid as long as the cell is unchanged.
+     */
+    inline std::string_view operator[](const size_t pColumnIdx) const
+    {
+      return (*_mRow)[pColumnIdx];
+    }
+
+    /**
+     * @brief   Get cell of the row, after checking the index is in range.
+     * @param   pColumnIdx            zero-based column-index.
+     * @returns cell data, valid as long as the cell is unchanged.
+     */
+    inline std::string_view at(const size_t pColumnIdx) const
+    {
+      return _mRow->at(pColumnIdx);
+    }
+
+    /**
+     * @brief   Get number of cells of the row.
+     * @returns column count.
+     */
+    inline size_t size() const
+    {
+      return _mRow->size();
+    }
+
+    /**
+     * @brief   Get the row-index in the Document.
+     * @returns zero-based row-index.
+     */
+    inline size_t GetRowIdx() const
+    {
+      return _mRowIdx;
+    }
+
+  private:
+    const std::vector<std::string>* _mRow;
+    size_t                          _mRowIdx;
+  };
+
+  /**
+   * @brief     Random-access range over the data rows of a Document or a view, yielding 'RowProxy' by value.
+   *            No allocation per row, and for a view a single indirection through its row-index map.
+   *            Satisfies 'std::ranges::random_access_range', 'sized_range', 'view' and 'borrowed_range'.
+   *            Valid until the Document's structure changes, or the view is refreshed.
+   * @tparam    T_C                   one for each of the first columns of a row, as for 'RowProxy'.
+   */
+  template< typename ... T_C >
+  class RowRange : public std::ranges::view_interface<RowRange<T_C ...>>
+  {
+  public:
+    /**
+     * @brief   random-access iterator, dereferencing to 'RowProxy<T_C...>' by value.
+     */
+    class iterator
+    {
+    public:
+      using iterator_concept  = std::random_access_iterator_tag;
+      using iterator_category = std::input_iterator_tag;   // 'reference' is not a reference type
+      using value_type        = RowProxy<T_C ...>;
+      using reference         = RowProxy<T_C ...>;
+      using difference_type   = std::ptrdiff_t;
+
+      iterator() = default;
+
+      iterator(const std::vector<std::string>* pRows, const size_t* pRowIdxs, const size_t pPos)
+        : _mRows(pRows)
+        , _mRowIdxs(pRowIdxs)
+        , _mPos(pPos)
+      {}
+
+      inline reference operator*() const
+      {
+        const size_t rowIdx = (_mRowIdxs == nullptr) ? _mPos : _mRowIdxs[_mPos];
+        return reference(_mRows[rowIdx], rowIdx);
+      }
+
+      inline reference operator[](const difference_type pOffset) const
+      {
+        return *(*this + pOffset);
+      }
+
+      inline iterator& operator++()                                    { ++_mPos; return *this; }
+      inline iterator  operator++(int)                                 { iterator it(*this); ++_mPos; return it; }
+      inline iterator& operator--()                                    { --_mPos; return *this; }
+      inline iterator  operator--(int)                                 { iterator it(*this); --_mPos; return it; }
+      inline iterator& operator+=(const difference_type pOffset)       { _mPos = _offset(pOffset); return *this; }
+      inline iterator& operator-=(const difference_type pOffset)       { _mPos = _offset(-pOffset); return *this; }
+
+      friend inline iterator operator+(const iterator& pIt, const difference_type pOffset)
+      {
+        return iterator(pIt._mRows, pIt._mRowIdxs, pIt._offset(pOffset));
+      }
+      friend inline iterator operator+(const difference_type pOffset, const iterator& pIt)
+      {
+        return pIt + pOffset;
+      }
+      friend inline iterator operator-(const iterator& pIt, const difference_type pOffset)
+      {
+        return pIt + (-pOffset);
+      }
+      friend inline difference_type operator-(const iterator& pLhs, const iterator& pRhs)
+      {
+        return static_cast<difference_type>(pLhs._mPos) - static_cast<difference_type>(pRhs._mPos);
+      }
+      friend inline bool operator==(const iterator& pLhs, const iterator& pRhs)
+      {
+        return pLhs._mPos == pRhs._mPos;
+      }
+      friend inline std::strong_ordering operator<=>(const iterator& pLhs, const iterator& pRhs)
+      {
+        return pLhs._mPos <=> pRhs._mPos;
+      }
+
+    private:
+      inline size_t _offset(const difference_type pOffset) const
+      {
+        return static_cast<size_t>(static_cast<difference_type>(_mPos) + pOffset);
+      }
+
+      const std::vector<std::string>* _mRows = nullptr;
+      const size_t*                   _mRowIdxs = nullptr;   // nullptr for all rows of a Document
+      size_t                          _mPos = 0;
+    };
+
+    RowRange() = default;
+
+    /**
+     * @brief   Constructor.
+     * @param   pRows                 first data row of the Document.
+     * @param   pRowIdxs              row-indexes of the rows in range order, nullptr for all rows in Document order.
+     * @param   pSize                 number of rows in range.
+     */
+    RowRange(const std::vector<std::string>* pRows, const size_t* pRowIdxs, const size_t pSize)
+      : _mRows(pRows)
+      , _mRowIdxs(pRowIdxs)
+      , _mSize(pSize)
+    {}
+
+    inline iterator begin() const
+    {
+      return iterator(_mRows, _mRowIdxs, 0);
+    }
+
+    inline iterator end() const
+    {
+      return iterator(_mRows, _mRowIdxs, _mSize);
+    }
+
+    inline size_t size() const
+    {
+      return _mSize;
+    }
+
+  private:
+    const std::vector<std::string>* _mRows = nullptr;
+    const size_t*                   _mRowIdxs = nullptr;
+    size_t                          _mSize = 0;
+  };
+
+  /**
+   * @brief     Kind of change of Document rows, as recorded in the Document's row change log.
+   */
+  enum e_RowChange
+  {
+    ROWS_INSERTED = 0,   // rows were inserted, indexes of the following rows increase
+    ROWS_REMOVED,        // rows were removed, indexes of the following rows decrease
+    ROWS_UPDATED,        // cells of the rows were set
+    ROWS_RESET           // all rows may have changed, i.e. Clear(), Load(), insert/remove of columns
+  };
+
+  /**
+   * @brief     Entry of the Document's row change log : the range of rows affected by a change.
+   */
+  struct RowChange
+  {
+    /**
+     * @brief   kind of change.
+     */
+    e_RowChange mChange;
+
+    /**
+     * @brief   zero-based index of the first affected row, as of directly after the change.
+     *          For 'ROWS_REMOVED' the index the first removed row had.
+     */
+    size_t      mRowIdx;
+
+    /**
+     * @brief   number of affected rows.
+     */
+    size_t      mRowCount;
+  };
+
   /**
    * @brief     Class representing a CSV document.
    */
@@ -256,6 +1117,11 @@ namespace rapidcsv
      */
     using t_dataRow = std::vector<std::string>;
 
+    /**
+     * @brief   type definition for the rows of a Document.
+     */
+    using t_dataTable = std::vector<t_dataRow>;
+
     /**
      * @brief   Constructor
      * @param   pPath                 specifies the path of an existing CSV-file to populate the Document
@@ -278,6 +1144,7 @@ namespace rapidcsv
       , _mIdxColumnNames()
       , _mIdxRowNames()
       , _mFirstCornerCell()
+      , _mRowChanges()
     {
       if (!_mPath.empty())
       {
@@ -306,6 +1173,7 @@ namespace rapidcsv
       , _mIdxColumnNames()
       , _mIdxRowNames()
       , _mFirstCornerCell()
+      , _mRowChanges()
     {
       _readCsv(pStream);
     }
@@ -385,6 +1253,8 @@ namespace rapidcsv
       _mIdxColumnNames.clear();
       _mIdxRowNames.clear();
       _mFirstCornerCell="";
+      ++_mStructureGeneration;
+      _logRowChange(ROWS_RESET, 0, 0);
 #ifdef HAS_CODECVT
       mIsUtf16 = false;
       mIsLE = false;
@@ -392,6 +1262,51 @@ namespace rapidcsv
       _mHasUtf8BOM = false;
     }
 
+    /**
+     * @brief   maximum number of entries kept in the row change log, when exceeded the older half is dropped.
+     */
+    static constexpr size_t s_RowChangeLogCapacity = 4096;
+
+    /**
+     * @brief   Get sequence number of the row change log, i.e. the number of row changes ever recorded.
+     *          Changes done after this call can be fetched by passing the returned value to 'GetRowChanges()'.
+     * @returns sequence number after the latest change.
+     */
+    inline size_t GetRowChangeSeq() const
+    {
+      return _mRowChangesFirstSeq + _mRowChanges.size();
+    }
+
+    /**
+     * @brief   Get sequence number of the oldest change still kept in the row change log.
+     *          A 'ROWS_RESET' change and exceeding 's_RowChangeLogCapacity' drop the older changes.
+     * @returns sequence number of the oldest available change.
+     */
+    inline size_t GetRowChangeFirstSeq() const
+    {
+      return _mRowChangesFirstSeq;
+    }
+
+    /**
+     * @brief   Get changes of rows recorded by insert/remove/set of rows or cells, and 'ROWS_RESET'
+     *          for changes of all rows. Changes by writing to a row reference (e.g. from 'EmplaceRow()')
+     *          are not recorded.
+     * @param   pSinceSeq             sequence number from 'GetRowChangeSeq()'.
+     * @returns changes done after 'pSinceSeq', in order. If some of these changes are no longer in
+     *          the log, then 'out_of_range' error is thrown.
+     */
+    std::span<const RowChange> GetRowChanges(const size_t pSinceSeq) const
+    {
+      if ( (pSinceSeq < _mRowChangesFirstSeq) || (pSinceSeq > GetRowChangeSeq()) )
+      {
+        static const std::string errMsg("rapidcsv::Document::GetRowChanges() : changes not available in row change log");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pSinceSeq=" << pSinceSeq << " , first seq=" << _mRowChangesFirstSeq
+                                  << " , seq=" << GetRowChangeSeq());
+        throw std::out_of_range(errMsg);
+      }
+      return std::span<const RowChange>(_mRowChanges).subspan(pSinceSeq - _mRowChangesFirstSeq);
+    }
+
     /**
      * @brief   Destructor.
      *
@@ -419,13 +1334,14 @@ namespace rapidcsv
      * @param   pColumnName           column label name.
      * @returns zero-based column index.
      */
-    size_t GetColumnIdx(const std::string& pColumnName) const
+    size_t GetColumnIdx(const std::string_view pColumnName) const
     {
       if (_mLabelParams.mColumnNameFlg == FlgColumnName::CN_PRESENT)
       {
-        if (_mColumnNamesIdx.find(pColumnName) != _mColumnNamesIdx.end())
+        const size_t columnIdx = _mColumnNamesIdx.find(pColumnName, _mIdxColumnNames);
+        if (columnIdx != _LabelIndex::npos)
         {
-          return _mColumnNamesIdx.at(pColumnName);
+          return columnIdx;
         } else {
           static const std::string errMsg("rapidcsv::Document::GetColumnIdx(pColumnName) : column not found for 'pColumnName'");
           RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnName='" << pColumnName << "'");
@@ -462,29 +1378,54 @@ namespace rapidcsv
     std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>
     GetColumn(const c_sizet_or_string auto& pColumnNameIdx) const
     {
-      const size_t pColumnIdx = GetColumnIdx(pColumnNameIdx);
       std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> column;
-      size_t rowIdx = 0;
-      for (auto itRow = _mData.begin();
-           itRow != _mData.end(); ++itRow, ++rowIdx)
+      GetColumn<T_C>(pColumnNameIdx, column);
+      return column;
+    }
+
+    /**
+     * @brief   Get column either by it's index or name, into a caller-owned vector. The vector is cleared
+     *          and refilled, hence it's allocated capacity is reused over repeated calls.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'vector<R>' to be filled with column data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    void GetColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                   std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>& pColumn) const
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      pColumn.clear();
+      pColumn.reserve(_mData.size());
+      _forEachColumnCell(pColumnNameIdx, columnIdx,
+                         [&pColumn](const size_t, const std::string& pCell)
+                         { pColumn.push_back(_S2Tdispatch<T_C>(pCell)); });
+    }
+
+    /**
+     * @brief   Get column either by it's index or name, into a caller-owned span of size 'GetRowCount()'.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'span<R>' to be filled with column data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    void GetColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                   const std::span<typename converter::t_S2Tconv_c<T_C>::return_type> pColumn) const
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      if (pColumn.size() != _mData.size())
       {
-        if (pColumnIdx < itRow->size())
-        {
-          const std::string& cellStrVal = itRow->at(pColumnIdx);
-          //typename converter::t_S2Tconv_c<T_C>::return_type val = converter::t_S2Tconv_c<T_C>::ToVal_args(cellStrVal, std::forward<ARGS>(args)...);
-          typename converter::t_S2Tconv_c<T_C>::return_type val = converter::t_S2Tconv_c<T_C>::ToVal(cellStrVal);
-          column.push_back(val);
-        } else {
-          static const std::string errMsg("rapidcsv::Document::GetColumn(pColumnNameIdx) : column not found for 'pColumnNameIdx'");
-          #if FLAG_RAPIDCSV_debug_log == 1
-            const size_t adjRowSize = itRow->size();
-            RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnNameIdx='" << pColumnNameIdx << "' : pColumnIdx{" << pColumnIdx << "} >= rowSize{"  \
-                                      << adjRowSize << "} : (number of columns on row index=" << rowIdx << ")");
-          #endif
-          throw std::out_of_range(errMsg);
-        }
+        static const std::string errMsg("rapidcsv::Document::GetColumn(pColumnNameIdx, pColumn) : span size is not same as number of data rows");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : span size=" << pColumn.size() << " , number of data rows=" << _mData.size());
+        throw std::out_of_range(errMsg);
       }
-      return column;
+      _forEachColumnCell(pColumnNameIdx, columnIdx,
+                         [&pColumn](const size_t pRowIdx, const std::string& pCell)
+                         { pColumn[pRowIdx] = _S2Tdispatch<T_C>(pCell); });
     }
 
     /**
@@ -503,6 +1444,65 @@ namespace rapidcsv
       return GetColumn< converter::f_S2Tconv_c< CONV_S2T > >(pColumnNameIdx);
     }
 
+    /**
+     * @brief   Get multiple columns either by their index or name, converting all of them in a single pass over the rows.
+     * @tparam  T_C                   one per column ; T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-names or zero-based column-indexes, one for each of 'T_C'.
+     * @returns 'tuple<vector<R>...>' of columns data. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     *          On conversion success variant has the converted value,
+     *          else the string value which caused failure during conversion.
+     */
+    template< typename ... T_C >
+    std::tuple<std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> ...>
+    GetColumns(const c_sizet_or_string auto& ... pColumnNameIdx) const
+    {
+      static_assert(sizeof...(T_C) > 0 && sizeof...(T_C) == sizeof...(pColumnNameIdx), "GetColumns() : one column-name/index is needed for each type");
+
+      const std::array<size_t, sizeof...(T_C)> columnIdxs{ GetColumnIdx(pColumnNameIdx) ... };
+      std::tuple<std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> ...> columns;
+      std::apply([this](auto& ... column) { (column.reserve(_mData.size()), ...); }, columns);
+
+      _getColumns(columnIdxs,
+                  [&columns, &columnIdxs]<size_t ... I>(const t_dataRow& pRowData, const size_t, std::index_sequence<I...>)
+                  {
+                    (std::get<I>(columns).push_back(_S2Tdispatch<T_C>(pRowData[columnIdxs[I]])), ...);
+                  });
+      return columns;
+    }
+
+    /**
+     * @brief   Get multiple columns either by their index or name, converting all of them in a single pass over the rows.
+     *          Column data is written into caller-provided spans, each of size 'GetRowCount()'.
+     * @tparam  T_C                   one per column ; T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumns              'tuple<span<R>...>' to be filled with columns data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     * @param   pColumnNameIdx        column-names or zero-based column-indexes, one for each of 'T_C'.
+     */
+    template< typename ... T_C >
+    void GetColumns(const std::tuple<std::span<typename converter::t_S2Tconv_c<T_C>::return_type> ...>& pColumns,
+                    const c_sizet_or_string auto& ... pColumnNameIdx) const
+    {
+      static_assert(sizeof...(T_C) > 0 && sizeof...(T_C) == sizeof...(pColumnNameIdx), "GetColumns() : one column-name/index is needed for each type");
+
+      const bool spanSizeOk = std::apply([this](const auto& ... column) { return ( (column.size() == _mData.size()) && ... ); }, pColumns);
+      if (!spanSizeOk)
+      {
+        static const std::string errMsg("rapidcsv::Document::GetColumns(pColumns) : span size is not same as number of data rows");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : number of data rows=" << _mData.size());
+        throw std::out_of_range(errMsg);
+      }
+
+      const std::array<size_t, sizeof...(T_C)> columnIdxs{ GetColumnIdx(pColumnNameIdx) ... };
+      _getColumns(columnIdxs,
+                  [&pColumns, &columnIdxs]<size_t ... I>(const t_dataRow& pRowData, const size_t pRowIdx, std::index_sequence<I...>)
+                  {
+                    ((std::get<I>(pColumns)[pRowIdx] = _S2Tdispatch<T_C>(pRowData[columnIdxs[I]])), ...);
+                  });
+    }
+
     /**
      * @brief   Set column either by it's index or name.
      * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
@@ -518,26 +1518,43 @@ namespace rapidcsv
                    const std::vector<typename converter::t_T2Sconv_c<T_C>::input_type>& pColumn)
     {
       const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      const size_t rowCount = _getDataRowCount();
+      _resizeColumn(columnIdx, pColumn.size());
 
-      while (pColumn.size() > _getDataRowCount())
+      size_t rowIdx = 0;
+      for (auto itCell = pColumn.begin(); itCell != pColumn.end(); ++itCell, ++rowIdx)
       {
-        t_dataRow row;
-        row.resize(_getDataColumnCount());
-        _mData.push_back(row);
+        _T2Sdispatch<T_C>(*itCell, _mData[rowIdx][columnIdx]);
       }
+      _logRowsSet(0, pColumn.size(), rowCount);
+    }
 
-      if ((columnIdx + 1) > _getDataColumnCount())
+    /**
+     * @brief   Set column either by it's index or name. For string column data (i.e 'T_C = std::string'),
+     *          the strings are moved into the Document, else same as the 'const' overload.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'vector<R>' of column data, which is consumed.
+     */
+    template< typename T_C >
+    void SetColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                   std::vector<typename converter::t_T2Sconv_c<T_C>::input_type>&& pColumn)
+    {
+      if constexpr (std::is_same_v<converter::t_T2Sconv_c<T_C>, converter::t_T2Sconv_c<std::string>>)
       {
-        for (auto itRow = _mData.begin(); itRow != _mData.end(); ++itRow)
+        const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+        const size_t rowCount = _getDataRowCount();
+        _resizeColumn(columnIdx, pColumn.size());
+
+        size_t rowIdx = 0;
+        for (auto itCell = pColumn.begin(); itCell != pColumn.end(); ++itCell, ++rowIdx)
         {
-          itRow->resize(columnIdx + 1);
+          _mData[rowIdx][columnIdx] = std::move(*itCell);
         }
-      }
-
-      size_t rowIdx = 0;
-      for (auto itCell = pColumn.begin(); itCell != pColumn.end(); ++itCell, ++rowIdx)
-      {
-        _mData.at(rowIdx).at(columnIdx) = converter::t_T2Sconv_c<T_C>::ToStr(*itCell);
+        _logRowsSet(0, pColumn.size(), rowCount);
+      } else {
+        SetColumn<T_C>(pColumnNameIdx, std::as_const(pColumn));
       }
     }
 
@@ -576,6 +1593,8 @@ namespace rapidcsv
       }
 
       _updateColumnNames("rapidcsv::Document::RemoveColumn()");
+      ++_mStructureGeneration;
+      _logRowChange(ROWS_RESET, 0, 0);
     }
 
     /**
@@ -616,7 +1635,7 @@ namespace rapidcsv
         size_t rowIdx = 0;
         for (auto itCell = pColumn.begin(); itCell != pColumn.end(); ++itCell, ++rowIdx)
         {
-          column.at(rowIdx) = converter::t_T2Sconv_c<T_C>::ToStr(*itCell);
+          _T2Sdispatch<T_C>(*itCell, column[rowIdx]);
         }
       }
 
@@ -639,6 +1658,8 @@ namespace rapidcsv
       }
 
       _updateColumnNames("rapidcsv::Document::InsertColumn()");
+      ++_mStructureGeneration;
+      _logRowChange(ROWS_RESET, 0, 0);
     }
 
     // TODO unit tests
@@ -694,13 +1715,14 @@ namespace rapidcsv
      * @param   pRowName              row label name.
      * @returns zero-based row index.
      */
-    size_t GetRowIdx(const std::string& pRowName) const
+    size_t GetRowIdx(const std::string_view pRowName) const
     {
       if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
       {
-        if (_mRowNamesIdx.find(pRowName) != _mRowNamesIdx.end())
+        const size_t rowIdx = _mRowNamesIdx.find(pRowName, _mIdxRowNames);
+        if (rowIdx != _LabelIndex::npos)
         {
-          return _mRowNamesIdx.at(pRowName);
+          return rowIdx;
         } else {
           static const std::string errMsg("rapidcsv::Document::GetRowIdx(pRowName) row not found for 'pRowName'");
           RAPIDCSV_DEBUG_LOG(errMsg << " : pRowName='" << pRowName << "'");
@@ -740,11 +1762,8 @@ namespace rapidcsv
       }
 
       //return std::make_tuple(S2Tconv::ToVal(rowData.at(colIdx++)) ...);  on ubuntu the tuple elements order gets reversed
-
-      using _t_tuple_result = std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type...>;
-      _t_tuple_result result;
-      converter::GetTuple< converter::t_S2Tconv_c<T_C>... >(rowData,result);
-      return result;
+      // braced-init-list below is evaluated left to right, hence the order is retained.
+      return _getRow<T_C...>(rowData, std::index_sequence_for<T_C...>{});
     }
 
     /**
@@ -775,6 +1794,35 @@ namespace rapidcsv
       return _mData.at(pRowIdx);
     }
 
+    /**
+     * @brief   Get row either by it's index or name, as views of the cells. No cell is copied.
+     *          The views are valid until the document is modified.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @returns 'vector<string_view>' of row data.
+     */
+    inline std::vector<std::string_view>
+    GetRow_VecStrView(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      std::vector<std::string_view> row;
+      GetRow_VecStrView(pRowNameIdx, row);
+      return row;
+    }
+
+    /**
+     * @brief   Get row either by it's index or name, as views of the cells, into a caller-owned vector.
+     *          The vector's allocated capacity is reused over repeated calls. The views are valid until
+     *          the document is modified.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @param   pRow                  'vector<string_view>' to be filled with row data.
+     */
+    inline void
+    GetRow_VecStrView(const c_sizet_or_string auto& pRowNameIdx,
+                      std::vector<std::string_view>& pRow) const
+    {
+      const t_dataRow& rowData = _mData.at(GetRowIdx(pRowNameIdx));
+      pRow.assign(rowData.begin(), rowData.end());
+    }
+
     /**
      * @brief   Set row either by it's index or name.
      * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
@@ -791,11 +1839,13 @@ namespace rapidcsv
                 const std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>& pRow)
     {
       const size_t rowIdx = GetRowIdx(pRowNameIdx);
+      const size_t rowCount = _getDataRowCount();
       _resizeTable(rowIdx, sizeof...(T_C) );
 
       t_dataRow& rowData = _mData.at(rowIdx);
 
-      converter::SetTuple< converter::t_T2Sconv_c<T_C>... >(pRow,rowData);
+      _setRow<T_C...>(pRow, rowData, std::index_sequence_for<T_C...>{});
+      _logRowsSet(rowIdx, 1, rowCount);
     }
 
     /**
@@ -824,6 +1874,7 @@ namespace rapidcsv
                        const std::vector<std::string>& pRow)
     {
       const size_t pRowIdx = GetRowIdx(pRowNameIdx);
+      const size_t rowCount = _getDataRowCount();
       _resizeTable(pRowIdx, pRow.size());
 
       auto itRowCell = _mData.at(pRowIdx).begin();
@@ -831,6 +1882,30 @@ namespace rapidcsv
       {
         (*itRowCell) = (*itEle);
       }
+      _logRowsSet(pRowIdx, 1, rowCount);
+    }
+
+    /**
+     * @brief   Set row either by it's index or name. The cells are moved into the Document.
+     * @param   pRowNameIdx           row-name or zero-based row index.
+     * @param   pRow                  'vector<string>' of row data, which is consumed.
+     */
+    void SetRow_VecStr(const c_sizet_or_string auto& pRowNameIdx,
+                       std::vector<std::string>&& pRow)
+    {
+      const size_t pRowIdx = GetRowIdx(pRowNameIdx);
+      const size_t rowCount = _getDataRowCount();
+      _resizeTable(pRowIdx, pRow.size());
+
+      t_dataRow& rowData = _mData.at(pRowIdx);
+      if (rowData.size() == pRow.size())
+      {
+        rowData.swap(pRow);
+        pRow.clear();
+      } else {
+        std::move(pRow.begin(), pRow.end(), rowData.begin());
+      }
+      _logRowsSet(pRowIdx, 1, rowCount);
     }
 
     /**
@@ -840,12 +1915,10 @@ namespace rapidcsv
     inline void RemoveRow(const c_sizet_or_string auto& pRowNameIdx)
     {
       const size_t pRowIdx = GetRowIdx(pRowNameIdx);
-      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
-      {
-        _mIdxRowNames.erase(_mIdxRowNames.begin() + static_cast<ssize_t>(pRowIdx));
-      }
+      _removeRowName(pRowIdx);
       _mData.erase(_mData.begin() + static_cast<ssize_t>(pRowIdx));
-      _updateRowNames("rapidcsv::Document::RemoveRow()");
+      ++_mStructureGeneration;
+      _logRowChange(ROWS_REMOVED, pRowIdx, 1);
     }
 
     /**
@@ -885,9 +1958,17 @@ namespace rapidcsv
       } else {
         rowData.resize(sizeof...(T_C));
 
-        converter::SetTuple< converter::t_T2Sconv_c<T_C>... >(pRow, rowData);
+        _setRow<T_C...>(pRow, rowData, std::index_sequence_for<T_C...>{});
+      }
+
+      std::vector<std::string> rowNames;
+      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
+      {
+        rowNames.push_back(pRowName);
       }
+      _checkNewRowNames(pRowIdx, 1, rowNames, "rapidcsv::Document::InsertRow()");
 
+      const size_t rowCount = _getDataRowCount();
       while (pRowIdx > _getDataRowCount())
       {
         t_dataRow tempRow;
@@ -895,14 +1976,11 @@ namespace rapidcsv
         _mData.push_back(tempRow);
       }
 
-      _mData.insert(_mData.begin() + static_cast<ssize_t>(pRowIdx), rowData);
-
-      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
-      {
-        _mIdxRowNames.insert(_mIdxRowNames.begin() + static_cast<ssize_t>(pRowIdx), pRowName);
-      }
+      _mData.insert(_mData.begin() + static_cast<ssize_t>(pRowIdx), std::move(rowData));
 
-      _updateRowNames("rapidcsv::Document::InsertRow()");
+      _insertRowNames(pRowIdx, rowNames);
+      ++_mStructureGeneration;
+      _logRowsInserted(pRowIdx, rowCount);
     }
 
     /**
@@ -935,6 +2013,19 @@ namespace rapidcsv
                           const std::vector<std::string>& pRow
                                          = std::vector<std::string>(),
                           const std::string& pRowName = std::string())
+    {
+      InsertRow_VecStr(pRowIdx, t_dataRow(pRow), pRowName);
+    }
+
+    /**
+     * @brief   Insert row at specified index. The cells are moved into the Document.
+     * @param   pRowIdx               zero-based row index.
+     * @param   pRow                  'vector<string>' of row data, which is consumed.
+     * @param   pRowName              row label name (optional argument).
+     */
+    void InsertRow_VecStr(const size_t pRowIdx,
+                          std::vector<std::string>&& pRow,
+                          const std::string& pRowName = std::string())
     {
       if (_mLabelParams.mRowNameFlg == FlgRowName::RN_MISSING && !pRowName.empty())
       {
@@ -948,34 +2039,148 @@ namespace rapidcsv
         throw std::out_of_range(errMsg);
       }
 
+      t_dataRow row(std::move(pRow));
+      pRow.clear();
+      if (row.empty())
+      {
+        row.resize(_getDataColumnCount());
+      }
+
+      std::vector<std::string> rowNames;
+      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
+      {
+        rowNames.push_back(pRowName);
+      }
+      _checkNewRowNames(pRowIdx, 1, rowNames, "rapidcsv::Document::InsertRow_VecStr()");
+
+      const size_t rowCount = _getDataRowCount();
+      while (pRowIdx > _getDataRowCount())
+      {
+        t_dataRow tempRow;
+        tempRow.resize(_getDataColumnCount());
+        _mData.push_back(tempRow);
+      }
+
+      _mData.insert(_mData.begin() + static_cast<ssize_t>(pRowIdx), std::move(row));
+
+      _insertRowNames(pRowIdx, rowNames);
+      ++_mStructureGeneration;
+      _logRowsInserted(pRowIdx, rowCount);
+    }
+
+    /**
+     * @brief   Insert row at specified index, constructing each cell in place from the arguments
+     *          (e.g. 'const char*', 'std::string_view', 'std::string&&').
+     * @tparam  CELLS                 types from which 'std::string' can be constructed.
+     * @param   pRowIdx               zero-based row index.
+     * @param   pRowName              row label name, should be empty string if 'FlgRowName::RN_MISSING'.
+     * @param   pCells                cells of the row. If none, the row has empty cells for each column.
+     * @returns reference to the inserted row, valid until the Document's rows are inserted/removed.
+     */
+    template< typename ... CELLS >
+    requires (std::is_constructible_v<std::string, CELLS&&> && ...)
+    t_dataRow& EmplaceRow(const size_t pRowIdx,
+                          const std::string& pRowName,
+                          CELLS&& ... pCells)
+    {
       t_dataRow row;
-      if (pRow.empty())
+      row.reserve(sizeof...(CELLS));
+      (row.emplace_back(std::forward<CELLS>(pCells)), ...);
+      InsertRow_VecStr(pRowIdx, std::move(row), pRowName);
+      return _mData[pRowIdx];
+    }
+
+    /**
+     * @brief   Insert rows at specified index. The rows are moved into the Document in one splice,
+     *          and only the new row-names are checked and added to the row label index.
+     * @param   pRowIdx               zero-based row index of the first inserted row.
+     * @param   pRows                 'vector<vector<string>>' of rows data. An empty row is resized to the column count.
+     * @param   pRowNames             row label names, one for each row of 'pRows' (optional argument).
+     */
+    void InsertRows_VecStr(const size_t pRowIdx,
+                           std::vector<t_dataRow>&& pRows,
+                           const std::vector<std::string>& pRowNames = std::vector<std::string>())
+    {
+      _checkNewRowNames(pRowIdx, pRows.size(), pRowNames, "rapidcsv::Document::InsertRows_VecStr()");
+
+      const size_t rowCount = _getDataRowCount();
+      const size_t columnCount = _getDataColumnCount();
+      for (auto& row : pRows)
       {
-        row.resize(_getDataColumnCount());
-      } else {
-        row.resize(pRow.size());
-        size_t colIdx = 0;
-        for (auto itCol = pRow.begin(); itCol != pRow.end(); ++itCol, ++colIdx)
+        if (row.empty())
         {
-          row.at(colIdx) = (*itCol);
+          row.resize(columnCount);
         }
       }
 
       while (pRowIdx > _getDataRowCount())
       {
         t_dataRow tempRow;
-        tempRow.resize(_getDataColumnCount());
+        tempRow.resize(columnCount);
         _mData.push_back(tempRow);
       }
 
-      _mData.insert(_mData.begin() + static_cast<ssize_t>(pRowIdx), row);
+      _mData.insert(_mData.begin() + static_cast<ssize_t>(pRowIdx),
+                    std::make_move_iterator(pRows.begin()), std::make_move_iterator(pRows.end()));
+      pRows.clear();
 
-      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
+      _insertRowNames(pRowIdx, pRowNames);
+      ++_mStructureGeneration;
+      _logRowsInserted(pRowIdx, rowCount);
+    }
+
+    /**
+     * @brief   Append rows at the end of the Document.
+     * @param   pRows                 'vector<vector<string>>' of rows data. An empty row is resized to the column count.
+     * @param   pRowNames             row label names, one for each row of 'pRows' (optional argument).
+     */
+    inline void AppendRows_VecStr(std::vector<t_dataRow>&& pRows,
+                                  const std::vector<std::string>& pRowNames = std::vector<std::string>())
+    {
+      InsertRows_VecStr(_getDataRowCount(), std::move(pRows), pRowNames);
+    }
+
+    /**
+     * @brief   Insert rows at specified index. The rows are converted, and then moved into the Document in one splice.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;    xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pRowIdx               zero-based row index of the first inserted row.
+     * @param   pRows                 'vector<tuple<R...>>' of rows data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromVal_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     *                                On conversion success variant has the converted value,
+     *                                else the string value which caused failure during conversion.
+     * @param   pRowNames             row label names, one for each row of 'pRows' (optional argument).
+     */
+    template< typename ... T_C >
+    void InsertRows(const size_t pRowIdx,
+                    const std::vector<std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>>& pRows,
+                    const std::vector<std::string>& pRowNames = std::vector<std::string>())
+    {
+      std::vector<t_dataRow> rows(pRows.size());
+      auto itRowData = rows.begin();
+      for (auto itRow = pRows.begin(); itRow != pRows.end(); ++itRow, ++itRowData)
       {
-        SetRowName(pRowIdx, pRowName);
+        itRowData->resize(sizeof...(T_C));
+        _setRow<T_C...>(*itRow, *itRowData, std::index_sequence_for<T_C...>{});
       }
+      InsertRows_VecStr(pRowIdx, std::move(rows), pRowNames);
+    }
 
-      _updateRowNames("rapidcsv::Document::InsertRow_VecStr()");
+    /**
+     * @brief   Append rows at the end of the Document.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;    xOR
+     *                                C -> Conversion class satisfying concept 'c_T2Sconverter'.
+     * @param   pRows                 'vector<tuple<R...>>' of rows data. By default, R is usually same type as T.
+     *                                Else if 'C ≃ converter::ConvertFromVal_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     *                                On conversion success variant has the converted value,
+     *                                else the string value which caused failure during conversion.
+     * @param   pRowNames             row label names, one for each row of 'pRows' (optional argument).
+     */
+    template< typename ... T_C >
+    inline void AppendRows(const std::vector<std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>>& pRows,
+                           const std::vector<std::string>& pRowNames = std::vector<std::string>())
+    {
+      InsertRows<T_C...>(_getDataRowCount(), pRows, pRowNames);
     }
 
     /**
@@ -1012,7 +2217,7 @@ namespace rapidcsv
       const size_t pColumnIdx = GetColumnIdx(pColumnNameIdx);
       const size_t pRowIdx = GetRowIdx(pRowNameIdx);
 
-      return converter::t_S2Tconv_c<T_C>::ToVal(_mData.at(pRowIdx).at(pColumnIdx));
+      return _S2Tdispatch<T_C>(_mData.at(pRowIdx).at(pColumnIdx));
     }
 
     // TODO function and unit tests  for ARGS...
@@ -1034,6 +2239,217 @@ namespace rapidcsv
       return GetCell< converter::f_S2Tconv_c< CONV_S2T > >(pColumnNameIdx, pRowNameIdx);
     }
 
+    /**
+     * @brief     Typed accessor of a column, with column-index resolved once.
+     *            The accessor stays valid until the Document's structure changes, i.e.
+     *            insert/remove of rows or columns, Clear() or Load().
+     * @tparam    T_C                 T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     */
+    template< typename T_C >
+    class ColumnAccessor
+    {
+    public:
+      using t_S2Tconv   = converter::t_S2Tconv_c<T_C>;
+      using return_type = typename t_S2Tconv::return_type;
+
+      ColumnAccessor(const Document& pDocument, const size_t pColumnIdx)
+        : _mDocument(pDocument)
+        , _mColumnIdx(pColumnIdx)
+        , _mStructureGeneration(pDocument._mStructureGeneration)
+      {}
+
+      /**
+       * @brief   Get cell of the column, without any validation.
+       * @param   pRowIdx             zero-based row-index.
+       * @returns cell data of type R. By default, R is usually same type as T.
+       */
+      inline return_type operator[](const size_t pRowIdx) const
+      {
+        return _S2Tdispatch<T_C>(_mDocument._mData[pRowIdx][_mColumnIdx]);
+      }
+
+      /**
+       * @brief   Get cell of the column, after checking that the accessor is valid and the index is in range.
+       * @param   pRowIdx             zero-based row-index.
+       * @returns cell data of type R. By default, R is usually same type as T.
+       */
+      return_type at(const size_t pRowIdx) const
+      {
+        if (!IsValid())
+        {
+          static const std::string errMsg("rapidcsv::Document::ColumnAccessor::at() : Document structure has changed after the accessor was created");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : columnIdx=" << _mColumnIdx);
+          throw std::out_of_range(errMsg);
+        }
+        return _S2Tdispatch<T_C>(_mDocument._mData.at(pRowIdx).at(_mColumnIdx));
+      }
+
+      /**
+       * @brief   Check if the Document structure is unchanged since creation of the accessor.
+       * @returns true if accessor can be used.
+       */
+      inline bool IsValid() const
+      {
+        return _mStructureGeneration == _mDocument._mStructureGeneration;
+      }
+
+      /**
+       * @brief   Get number of rows accessible.
+       * @returns row count.
+       */
+      inline size_t size() const
+      {
+        return _mDocument._getDataRowCount();
+      }
+
+      /**
+       * @brief   Get resolved column-index.
+       * @returns zero-based column-index.
+       */
+      inline size_t GetColumnIdx() const
+      {
+        return _mColumnIdx;
+      }
+
+    private:
+      const Document& _mDocument;
+      const size_t    _mColumnIdx;
+      const size_t    _mStructureGeneration;
+    };
+
+    /**
+     * @brief     Typed accessor of a row, with row-index resolved once.
+     *            The accessor stays valid until the Document's structure changes, i.e.
+     *            insert/remove of rows or columns, Clear() or Load().
+     * @tparam    T_C                 T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     */
+    template< typename T_C >
+    class RowAccessor
+    {
+    public:
+      using t_S2Tconv   = converter::t_S2Tconv_c<T_C>;
+      using return_type = typename t_S2Tconv::return_type;
+
+      RowAccessor(const Document& pDocument, const size_t pRowIdx)
+        : _mDocument(pDocument)
+        , _mRowIdx(pRowIdx)
+        , _mStructureGeneration(pDocument._mStructureGeneration)
+      {}
+
+      /**
+       * @brief   Get cell of the row, without any validation.
+       * @param   pColumnIdx          zero-based column-index.
+       * @returns cell data of type R. By default, R is usually same type as T.
+       */
+      inline return_type operator[](const size_t pColumnIdx) const
+      {
+        return _S2Tdispatch<T_C>(_mDocument._mData[_mRowIdx][pColumnIdx]);
+      }
+
+      /**
+       * @brief   Get cell of the row, after checking that the accessor is valid and the index is in range.
+       * @param   pColumnIdx          zero-based column-index.
+       * @returns cell data of type R. By default, R is usually same type as T.
+       */
+      return_type at(const size_t pColumnIdx) const
+      {
+        if (!IsValid())
+        {
+          static const std::string errMsg("rapidcsv::Document::RowAccessor::at() : Document structure has changed after the accessor was created");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : rowIdx=" << _mRowIdx);
+          throw std::out_of_range(errMsg);
+        }
+        return _S2Tdispatch<T_C>(_mDocument._mData.at(_mRowIdx).at(pColumnIdx));
+      }
+
+      /**
+       * @brief   Check if the Document structure is unchanged since creation of the accessor.
+       * @returns true if accessor can be used.
+       */
+      inline bool IsValid() const
+      {
+        return _mStructureGeneration == _mDocument._mStructureGeneration;
+      }
+
+      /**
+       * @brief   Get number of columns accessible.
+       * @returns column count.
+       */
+      inline size_t size() const
+      {
+        return _mDocument._mData.at(_mRowIdx).size();
+      }
+
+      /**
+       * @brief   Get resolved row-index.
+       * @returns zero-based row-index.
+       */
+      inline size_t GetRowIdx() const
+      {
+        return _mRowIdx;
+      }
+
+    private:
+      const Document& _mDocument;
+      const size_t    _mRowIdx;
+      const size_t    _mStructureGeneration;
+    };
+
+    /**
+     * @brief   Get range over all data rows, for use with range-for and 'std::ranges' algorithms.
+     * @tparam  T_C                   one for each of the first columns of a row, for typed access by 'RowProxy::get<I>()'.
+     *                                T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @returns 'RowRange<T_C...>', valid until the Document's structure changes.
+     */
+    template< typename ... T_C >
+    inline RowRange<T_C ...> GetRowRange() const
+    {
+      return RowRange<T_C ...>(_mData.data(), nullptr, _mData.size());
+    }
+
+    /**
+     * @brief   Get typed accessor of a column either by it's index or name. The column-name is resolved only once.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'ColumnAccessor<T_C>', valid until the Document's structure changes.
+     */
+    template< typename T_C >
+    ColumnAccessor<T_C> GetColumnAccessor(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      const size_t columnIdx = GetColumnIdx(pColumnNameIdx);
+      if (columnIdx >= _getDataColumnCount())
+      {
+        static const std::string errMsg("rapidcsv::Document::GetColumnAccessor() : column index out of range");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : columnIdx=" << columnIdx);
+        throw std::out_of_range(errMsg);
+      }
+      return ColumnAccessor<T_C>(*this, columnIdx);
+    }
+
+    /**
+     * @brief   Get typed accessor of a row either by it's index or name. The row-name is resolved only once.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pRowNameIdx           row-name or zero-based row-index.
+     * @returns 'RowAccessor<T_C>', valid until the Document's structure changes.
+     */
+    template< typename T_C >
+    RowAccessor<T_C> GetRowAccessor(const c_sizet_or_string auto& pRowNameIdx) const
+    {
+      const size_t rowIdx = GetRowIdx(pRowNameIdx);
+      if (rowIdx >= _getDataRowCount())
+      {
+        static const std::string errMsg("rapidcsv::Document::GetRowAccessor() : row index out of range");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : rowIdx=" << rowIdx);
+        throw std::out_of_range(errMsg);
+      }
+      return RowAccessor<T_C>(*this, rowIdx);
+    }
+
     // TODO function and unit tests  for ARGS...
     /**
      * @brief   Set cell either by it's index or name.
@@ -1053,6 +2469,7 @@ namespace rapidcsv
     {
       const size_t pColumnIdx = GetColumnIdx(pColumnNameIdx);
       const size_t pRowIdx = GetRowIdx(pRowNameIdx);
+      const size_t rowCount = _getDataRowCount();
 
       while ((pRowIdx + 1) > _getDataRowCount())
       {
@@ -1069,7 +2486,8 @@ namespace rapidcsv
         }
       }
 
-      _mData.at(pRowIdx).at(pColumnIdx) = converter::t_T2Sconv_c<T_C>::ToStr(pCell);
+      _T2Sdispatch<T_C>(pCell, _mData.at(pRowIdx).at(pColumnIdx));
+      _logRowsSet(pRowIdx, 1, rowCount);
     }
 
     // TODO function and unit tests  for ARGS...
@@ -1127,10 +2545,10 @@ namespace rapidcsv
         throw std::out_of_range(errMsg);
       }
 
-      auto search = _mColumnNamesIdx.find(pColumnName);
-      if( search != _mColumnNamesIdx.end() )
+      const size_t search = _mColumnNamesIdx.find(pColumnName, _mIdxColumnNames);
+      if( search != _LabelIndex::npos )
       {
-        if (search->second == pColumnIdx)
+        if (search == pColumnIdx)
           return; // same data exists: do nothing : return
 
         static const std::string errMsg("rapidcsv::Document::SetColumnName() : 'pColumnIdx' has to be unique, duplicate names not allowed");
@@ -1142,12 +2560,11 @@ namespace rapidcsv
       {
         _mIdxColumnNames.resize(pColumnIdx + 1);
       } else {
-        std::string prvName = _mIdxColumnNames.at(pColumnIdx);
-        _mColumnNamesIdx.erase(prvName);
+        _mColumnNamesIdx.erase(_mIdxColumnNames.at(pColumnIdx), _mIdxColumnNames);
       }
 
-      _mColumnNamesIdx[pColumnName] = pColumnIdx;
       _mIdxColumnNames.at(pColumnIdx) = pColumnName;
+      _mColumnNamesIdx.insert(pColumnIdx, _mIdxColumnNames);
     }
 
     /**
@@ -1198,10 +2615,10 @@ namespace rapidcsv
         throw std::out_of_range(errMsg);
       }
 
-      auto search = _mRowNamesIdx.find(pRowName);
-      if( search != _mRowNamesIdx.end() )
+      const size_t search = _mRowNamesIdx.find(pRowName, _mIdxRowNames);
+      if( search != _LabelIndex::npos )
       {
-        if (search->second == pRowIdx)
+        if (search == pRowIdx)
           return; // same data exists: do nothing : return
 
         static const std::string errMsg("rapidcsv::Document::SetRowName() : 'pRowName' has to be unique, duplicate names not allowed");
@@ -1213,12 +2630,11 @@ namespace rapidcsv
       {
         _mIdxRowNames.resize(pRowIdx + 1);
       } else {
-        std::string prvName = _mIdxRowNames.at(pRowIdx);
-        _mRowNamesIdx.erase(prvName);
+        _mRowNamesIdx.erase(_mIdxRowNames.at(pRowIdx), _mIdxRowNames);
       }
 
-      _mRowNamesIdx[pRowName] = pRowIdx;
       _mIdxRowNames.at(pRowIdx) = pRowName;
+      _mRowNamesIdx.insert(pRowIdx, _mIdxRowNames);
     }
 
     /**
@@ -1235,7 +2651,96 @@ namespace rapidcsv
       return std::vector<std::string>();
     }
 
+    /**
+     * @brief   Get cells of a data row, without the row-name cell. Read access for query classes such as
+     *          'FilterPlan', 'HashIndex', 'GroupBy' and the join functions. Only intended for internal usage.
+     * @param   pRowIdx               zero-based row index, not checked, must be less than '_getDataRowCount()'.
+     * @returns row cells, valid until the Document's rows are inserted/removed.
+     */
+    inline const t_dataRow& _getDataRow(const size_t pRowIdx) const
+    {
+      return _mData[pRowIdx];
+    }
+
+    /**
+     * @brief   Get number of data rows. Only intended for internal usage.
+     * @returns row count.
+     */
+    inline size_t _getDataRowCount() const
+    {
+      return _mData.size();
+    }
+
+    /**
+     * @brief   Get the label parameters the Document was created with. Only intended for internal usage.
+     * @returns label parameters.
+     */
+    inline const LabelParams& _getLabelParams() const
+    {
+      return _mLabelParams;
+    }
+
   private:
+    template< typename ... T_C, size_t ... I >
+    static inline std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+    _getRow(const t_dataRow& pRowData, std::index_sequence<I...>)
+    {
+      return std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+               { _S2Tdispatch<T_C>(pRowData[I]) ... };
+    }
+
+    // calls 'pConvertCell(rowIdx, cell)' for each cell of column 'pColumnIdx'.
+    template< typename F >
+    inline void _forEachColumnCell(const c_sizet_or_string auto& pColumnNameIdx, const size_t pColumnIdx,
+                                   F&& pConvertCell) const
+    {
+      size_t rowIdx = 0;
+      for (auto itRow = _mData.begin();
+           itRow != _mData.end(); ++itRow, ++rowIdx)
+      {
+        if (pColumnIdx < itRow->size())
+        {
+          pConvertCell(rowIdx, (*itRow)[pColumnIdx]);
+        } else {
+          static const std::string errMsg("rapidcsv::Document::GetColumn(pColumnNameIdx) : column not found for 'pColumnNameIdx'");
+          #if FLAG_RAPIDCSV_debug_log == 1
+            const size_t adjRowSize = itRow->size();
+            RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnNameIdx='" << pColumnNameIdx << "' : pColumnIdx{" << pColumnIdx << "} >= rowSize{"  \
+                                      << adjRowSize << "} : (number of columns on row index=" << rowIdx << ")");
+          #else
+            (void)pColumnNameIdx;
+          #endif
+          throw std::out_of_range(errMsg);
+        }
+      }
+    }
+
+    // calls 'pConvertRow(rowData, rowIdx, index_sequence)' for each row, after checking all columns are present in the row.
+    template< size_t N, typename F >
+    inline void _getColumns(const std::array<size_t, N>& pColumnIdxs, F&& pConvertRow) const
+    {
+      const size_t maxColumnIdx = *std::max_element(pColumnIdxs.begin(), pColumnIdxs.end());
+      size_t rowIdx = 0;
+      for (auto itRow = _mData.begin(); itRow != _mData.end(); ++itRow, ++rowIdx)
+      {
+        if (maxColumnIdx >= itRow->size())
+        {
+          static const std::string errMsg("rapidcsv::Document::GetColumns() : column not found for 'pColumnNameIdx'");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : columnIdx{" << maxColumnIdx << "} >= rowSize{" << itRow->size()
+                                    << "} : (number of columns on row index=" << rowIdx << ")");
+          throw std::out_of_range(errMsg);
+        }
+        pConvertRow(*itRow, rowIdx, std::make_index_sequence<N>{});
+      }
+    }
+
+    template< typename ... T_C, size_t ... I >
+    static inline void _setRow(const std::tuple<typename converter::t_T2Sconv_c<T_C>::input_type ...>& pRow,
+                               t_dataRow& pRowData, std::index_sequence<I...>)
+    {
+      (_T2Sdispatch<T_C>(std::get<I>(pRow), pRowData[I]), ...);
+    }
+
     void _readCsv()
     {
       std::ifstream stream;
@@ -1599,11 +3104,6 @@ namespace rapidcsv
       }
     }
 
-    inline size_t _getDataRowCount() const
-    {
-      return _mData.size();
-    }
-
     inline size_t _getDataColumnCount() const
     {
       return (_mData.size() > 0) ? _mData.at(0).size() : 0;
@@ -1665,14 +3165,14 @@ namespace rapidcsv
             throw std::out_of_range(errMsg);
           }
 
-          if( _mColumnNamesIdx.find(columnName) != _mColumnNamesIdx.end() )
+          if( !_mColumnNamesIdx.insert(i, _mIdxColumnNames) )
           {
             static const std::string errMsg("rapidcsv::Document::_updateColumnNames() : 'columnName' has to be unique, duplicate names not allowed");
             RAPIDCSV_DEBUG_LOG(errMsg << " : columnName='" << columnName << "'");
             throw std::out_of_range(errMsg);
           }
 
-          _mColumnNamesIdx[columnName] = i++;
+          ++i;
         }
       } else {
         _mIdxColumnNames.clear();
@@ -1694,20 +3194,111 @@ namespace rapidcsv
             throw std::out_of_range(errMsg);
           }
 
-          if( _mRowNamesIdx.find(rowName) != _mRowNamesIdx.end() )
+          if( !_mRowNamesIdx.insert(i, _mIdxRowNames) )
           {
             static const std::string errMsg("rapidcsv::Document::_updateRowNames() : 'rowName' has to be unique, duplicate names not allowed");
             RAPIDCSV_DEBUG_LOG(errMsg << " : rowName='" << rowName << "'");
             throw std::out_of_range(errMsg);
           }
 
-          _mRowNamesIdx[rowName] = i++;
+          ++i;
         }
       } else {
         _mIdxRowNames.clear();
       }
     }
 
+    // validates row-names of rows about to be inserted, before any data is modified.
+    void _checkNewRowNames(const size_t pRowIdx, const size_t pRowCount,
+                           const std::vector<std::string>& pRowNames,
+                           [[maybe_unused]]const std::string& calleeFunction) const
+    {
+      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_MISSING)
+      {
+        if (!pRowNames.empty())
+        {
+          static const std::string errMsg("rapidcsv::Document::_checkNewRowNames() : _mLabelParams.mRowNameFlg = FlgRowName::RN_MISSING -> can't process Row-Name");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : calleeFunction='" << calleeFunction << "'");
+          throw std::out_of_range(errMsg);
+        }
+        return;
+      }
+
+      if (pRowNames.size() != pRowCount)
+      {
+        static const std::string errMsg("rapidcsv::Document::_checkNewRowNames() : _mLabelParams.mRowNameFlg = FlgRowName::RN_PRESENT -> number of Row-Names should match number of rows");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowNames.size()=" << pRowNames.size() << " pRowCount=" << pRowCount << " calleeFunction='" << calleeFunction << "'");
+        throw std::out_of_range(errMsg);
+      }
+
+      if (pRowIdx > _mIdxRowNames.size())
+      {
+        static const std::string errMsg("rapidcsv::Document::_checkNewRowNames() : _mLabelParams.mRowNameFlg = FlgRowName::RN_PRESENT -> can't insert beyond last row, as padding rows would be without Row-Name");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : pRowIdx=" << pRowIdx << " calleeFunction='" << calleeFunction << "'");
+        throw std::out_of_range(errMsg);
+      }
+
+      std::map<std::string, size_t> newRowNamesIdx;
+      size_t i = 0;
+      for (auto& rowName : pRowNames)
+      {
+        if (rowName.empty())
+        {
+          static const std::string errMsg("rapidcsv::Document::_checkNewRowNames() : _mLabelParams.mRowNameFlg = FlgRowName::RN_PRESENT -> Row-Name can't be empty string");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : index=" << i << " calleeFunction='" << calleeFunction << "'");
+          throw std::out_of_range(errMsg);
+        }
+
+        if ( (_mRowNamesIdx.find(rowName, _mIdxRowNames) != _LabelIndex::npos) ||
+             (!newRowNamesIdx.emplace(rowName, i).second) )
+        {
+          static const std::string errMsg("rapidcsv::Document::_checkNewRowNames() : 'rowName' has to be unique, duplicate names not allowed");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : rowName='" << rowName << "' calleeFunction='" << calleeFunction << "'");
+          throw std::out_of_range(errMsg);
+        }
+        ++i;
+      }
+    }
+
+    // incremental update of row-labels, for rows inserted at 'pRowIdx'.
+    // 'pRowNames' should have been validated by '_checkNewRowNames()'.
+    void _insertRowNames(const size_t pRowIdx, const std::vector<std::string>& pRowNames)
+    {
+      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_MISSING || pRowNames.empty())
+      {
+        return;
+      }
+
+      if (pRowIdx < _mIdxRowNames.size())
+      {
+        // shift the indexes of existing rows placed after the inserted rows
+        _mRowNamesIdx.shift(pRowIdx, static_cast<ssize_t>(pRowNames.size()));
+      }
+
+      _mIdxRowNames.insert(_mIdxRowNames.begin() + static_cast<ssize_t>(pRowIdx),
+                           pRowNames.begin(), pRowNames.end());
+      for (size_t rowIdx = pRowIdx; rowIdx < (pRowIdx + pRowNames.size()); ++rowIdx)
+      {
+        _mRowNamesIdx.insert(rowIdx, _mIdxRowNames);
+      }
+    }
+
+    // incremental update of row-labels, for row removed at 'pRowIdx'.
+    void _removeRowName(const size_t pRowIdx)
+    {
+      if (_mLabelParams.mRowNameFlg == FlgRowName::RN_PRESENT)
+      {
+        const bool isLastRow = ((pRowIdx + 1) >= _mIdxRowNames.size());
+        _mRowNamesIdx.erase(_mIdxRowNames.at(pRowIdx), _mIdxRowNames);
+        _mIdxRowNames.erase(_mIdxRowNames.begin() + static_cast<ssize_t>(pRowIdx));
+        if (!isLastRow)
+        {
+          // shift the indexes of rows placed after the removed row
+          _mRowNamesIdx.shift(pRowIdx + 1, -1);
+        }
+      }
+    }
+
 #ifdef HAS_CODECVT
 #if defined(_MSC_VER)
 #pragma warning (push)
@@ -1742,12 +3333,15 @@ namespace rapidcsv
     LabelParams _mLabelParams;
     SeparatorParams _mSeparatorParams;
     LineReaderParams _mLineReaderParams;
-    std::vector<t_dataRow> _mData;
-    std::map<std::string, size_t> _mColumnNamesIdx;
-    std::map<std::string, size_t> _mRowNamesIdx;
+    t_dataTable _mData;
+    _LabelIndex                   _mColumnNamesIdx;   // indexes into '_mIdxColumnNames'
+    _LabelIndex                   _mRowNamesIdx;      // indexes into '_mIdxRowNames'
     std::vector<std::string>      _mIdxColumnNames;
     std::vector<std::string>      _mIdxRowNames;
     std::string                   _mFirstCornerCell;  // applicable only when both Row and Column Lables are PRESENT
+    size_t                        _mStructureGeneration = 0;  // incremented on insert/remove of rows or columns, Clear() and Load()
+    std::vector<RowChange>        _mRowChanges;
+    size_t                        _mRowChangesFirstSeq = 0;   // sequence number of '_mRowChanges.front()'
 #ifdef HAS_CODECVT
     bool mIsUtf16 = false;
     bool mIsLE = false;
@@ -1755,6 +3349,68 @@ namespace rapidcsv
     bool _mHasUtf8BOM = false;
 
 
+    void _resizeColumn(const size_t pColumnIdx, const size_t pColumnSize)
+    {
+      while (pColumnSize > _getDataRowCount())
+      {
+        t_dataRow row;
+        row.resize(_getDataColumnCount());
+        _mData.push_back(row);
+      }
+
+      if ((pColumnIdx + 1) > _getDataColumnCount())
+      {
+        for (auto itRow = _mData.begin(); itRow != _mData.end(); ++itRow)
+        {
+          itRow->resize(pColumnIdx + 1);
+        }
+      }
+
+      // ragged rows, shorter than the first row, are padded up to the column
+      for (size_t rowIdx = 0; rowIdx < pColumnSize; ++rowIdx)
+      {
+        t_dataRow& row = _mData[rowIdx];
+        if (row.size() <= pColumnIdx)
+        {
+          row.resize(pColumnIdx + 1);
+        }
+      }
+    }
+
+    void _logRowChange(const e_RowChange pChange, const size_t pRowIdx, const size_t pRowCount)
+    {
+      if (pChange == ROWS_RESET)
+      {
+        // older changes are meaningless after a reset
+        _mRowChangesFirstSeq += _mRowChanges.size();
+        _mRowChanges.clear();
+      } else if (pRowCount == 0) {
+        return;
+      } else if (_mRowChanges.size() >= s_RowChangeLogCapacity) {
+        const size_t dropCount = _mRowChanges.size() / 2;
+        _mRowChanges.erase(_mRowChanges.begin(), _mRowChanges.begin() + static_cast<ssize_t>(dropCount));
+        _mRowChangesFirstSeq += dropCount;
+      }
+      _mRowChanges.push_back(RowChange{ pChange, pRowIdx, pRowCount });
+    }
+
+    // rows inserted at 'pRowIdx', after padding rows if 'pRowIdx' was beyond the 'pRowCount' rows before.
+    inline void _logRowsInserted(const size_t pRowIdx, const size_t pRowCount)
+    {
+      const size_t firstRowIdx = std::min(pRowIdx, pRowCount);
+      _logRowChange(ROWS_INSERTED, firstRowIdx, _getDataRowCount() - pRowCount);
+    }
+
+    // rows [pRowIdx, pRowIdx+pSetCount) set, after appending rows to the 'pRowCount' rows before if needed.
+    void _logRowsSet(const size_t pRowIdx, const size_t pSetCount, const size_t pRowCount)
+    {
+      if (pRowIdx < pRowCount)
+      {
+        _logRowChange(ROWS_UPDATED, pRowIdx, std::min(pRowIdx + pSetCount, pRowCount) - pRowIdx);
+      }
+      _logRowChange(ROWS_INSERTED, pRowCount, _getDataRowCount() - pRowCount);
+    }
+
     void _resizeTable(const size_t pRowIdx, const size_t pRowSize)
     {
       while ((pRowIdx + 1) > _getDataRowCount())
@@ -1771,8 +3427,33 @@ namespace rapidcsv
           itRow->resize(pRowSize);
         }
       }
+
+      // a ragged row, shorter than the first row, is padded up to the row size
+      t_dataRow& row = _mData[pRowIdx];
+      if (row.size() < pRowSize)
+      {
+        row.resize(pRowSize);
+      }
     }
 
     friend class _ViewDocument;
+    friend class ColumnarDocument;
+    friend class LazyDocument;
+    friend class _RowTokenizer;
+  };
+}
+
+namespace std
+{
+  template< typename ... T_C >
+  struct tuple_size<rapidcsv::RowProxy<T_C ...>> : std::integral_constant<size_t, sizeof...(T_C)> {};
+
+  template< size_t I, typename ... T_C >
+  struct tuple_element<I, rapidcsv::RowProxy<T_C ...>>
+  {
+    using type = typename rapidcsv::RowProxy<T_C ...>::template t_cell<I>;
   };
+
+  template< typename ... T_C >
+  inline constexpr bool ranges::enable_borrowed_range<rapidcsv::RowRange<T_C ...>> = true;
 }
@@ -13,10 +13,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <vector>
-#include <map>
+#include <utility>
+#include <memory>
+#include <memory_resource>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <span>
+#include <optional>
+#include <type_traits>
+#include <atomic>
 
 #include <rapidcsv/rapidcsv.h>
 
@@ -78,7 +88,16 @@ namespace rapidcsv
     getValue(const Document::t_dataRow& pRowData) const
     {
       const std::string& cellStr = pRowData.at(_rawDataColumnIndex);
-      return S2Tconv_type::ToVal(cellStr);
+      return _S2Tdispatch<S2Tconv_type>(cellStr);
+    }
+
+    /**
+     * @brief   Gets the column index of the sorted column.
+     * @returns zero-based column index in CSV file.
+     */
+    inline size_t getColumnIndex() const
+    {
+      return _rawDataColumnIndex;
     }
   };
 
@@ -202,9 +221,85 @@ namespace rapidcsv
     {
       return _compare<0>(lhCompositeKey,rhCompositeKey);
     }
+
+    /**
+     * @brief   Three-way compare the leading components of an index key with a key prefix.
+     * @tparam  T_P                      types of the prefix components, comparable with the key components.
+     * @param   pCompositeKey            key to be compared.
+     * @param   pKeyPrefix               first 'sizeof...(T_P)' components of a key.
+     * @returns negative if 'pCompositeKey' is ordered before 'pKeyPrefix', zero if the leading components
+     *          are equal, else positive.
+     */
+    template<typename ... T_P>
+      requires (sizeof...(T_P) <= sizeof...(SPtypes))
+    static int comparePrefix(const t_sortKey& pCompositeKey,
+                             const std::tuple<T_P ...>& pKeyPrefix)
+    {
+      int result = 0;
+      [&]<size_t ... I>(std::index_sequence<I ...>)
+      {
+        // stops at the first component which differs
+        static_cast<void>( ( ((result = _compareValue<I>(std::get<I>(pCompositeKey), std::get<I>(pKeyPrefix))) == 0) && ... ) );
+      }(std::index_sequence_for<T_P ...>{});
+      return result;
+    }
+
+  private:
+    template<size_t I, typename T_V>
+    inline static int _compareValue(const typename std::tuple_element_t<I, t_tuple_SortParams>::return_type& lhVal,
+                                    const T_V& rhVal)
+    {
+      using t_tupleSPtype = std::tuple_element_t<I, t_tuple_SortParams>;
+
+      if constexpr ( t_tupleSPtype::sortOrder == e_SortOrder::ASCEND )
+      {
+        if(lhVal < rhVal)  return -1;
+        if(lhVal > rhVal)  return 1;
+      } else {
+        if(lhVal > rhVal)  return -1;
+        if(lhVal < rhVal)  return 1;
+      }
+      return 0;
+    }
   };
 
 
+  /**
+   * @brief     Column reference, either by name or zero-based index, resolved on a Document later.
+   *            Only intended for internal usage.
+   */
+  class _ColumnRef
+  {
+  public:
+    explicit _ColumnRef(const c_sizet_or_string auto& pColumnNameIdx)
+      : _mName()
+      , _mIdx(0)
+      , _mByName(!std::is_convertible_v<decltype(pColumnNameIdx), size_t>)
+    {
+      if constexpr (std::is_convertible_v<decltype(pColumnNameIdx), size_t>)
+      {
+        _mIdx = static_cast<size_t>(pColumnNameIdx);
+      } else {
+        _mName = std::string(pColumnNameIdx);
+      }
+    }
+
+    /**
+     * @brief   Get column index in a Document.
+     * @param   pDocument             'Document' or 'ColumnarDocument' object with CSV data.
+     * @returns zero-based column index.
+     */
+    size_t resolve(const auto& pDocument) const
+    {
+      return _mByName ? pDocument.GetColumnIdx(_mName) : _mIdx;
+    }
+
+  private:
+    std::string _mName;
+    size_t      _mIdx;
+    bool        _mByName;
+  };
+
   /**
    * @brief     Class representing a CSV document view. The underlying 'Document' is viewed after
    *            applying filter and/or sort on rows, based on cell values after type-conversion.
@@ -220,25 +315,72 @@ namespace rapidcsv
     /**
      * @brief a reference to the data structure, which derived class of _ViewDocument can use.
     */
-    const std::vector<Document::t_dataRow>& _mData;
+    const Document::t_dataTable& _mData;
     /**
      * @brief indexes of the vector represents view-row-idx.
      *        the values of the vector are the indexes in the data-structure of '_mData'.
      */
-    std::vector< size_t> _mapViewRowIdx2RowIdx;
+    std::pmr::vector<size_t> _mapViewRowIdx2RowIdx;
     /**
      * @brief indexes of the vector represents the index in the data-structure of '_mData'.
      *        the values of the vector are view-row-idx.
      *        Since some rows in '_mData' might get filtered out and in that case would be
      *        seen in the view,  those '_mData' indexes will have value -1 to indicate filtered out data.
+     *        Built from '_mapViewRowIdx2RowIdx' on first lookup by row name, so that creating a view
+     *        costs the number of rows visited rather than the number of rows of the Document.
+     *        As it is built from const member functions, it is published once by compare-exchange,
+     *        and owned by the view. nullptr until built.
      */
-    std::vector<ssize_t> _mapRowIdx2ViewRowIdx;
+    mutable std::atomic<std::pmr::vector<ssize_t>*> _mapRowIdx2ViewRowIdx;
+    /**
+     * @brief row change sequence number of the Document, when the view was created or last refreshed.
+     */
+    size_t _mRowChangeSeq;
+    /**
+     * @brief true if the view was created from another view, instead of from the Document.
+     */
+    const bool _mHasParentView;
 
-    explicit _ViewDocument(const Document& document)
+    // 'pResource' of nullptr selects the default memory resource.
+    explicit _ViewDocument(const Document& document, std::pmr::memory_resource* pResource)
       : _document(document),     _mData(document._mData),
-        _mapViewRowIdx2RowIdx(), _mapRowIdx2ViewRowIdx()
+        _mapViewRowIdx2RowIdx(_resolveResource(pResource)),
+        _mapRowIdx2ViewRowIdx(nullptr),
+        _mRowChangeSeq(document.GetRowChangeSeq()),
+        _mHasParentView(false)
+    {}
+
+    // view on the same Document as 'parent'; 'pResource' of nullptr selects the default memory resource.
+    explicit _ViewDocument(const _ViewDocument& parent, std::pmr::memory_resource* pResource)
+      : _document(parent._document),     _mData(parent._mData),
+        _mapViewRowIdx2RowIdx(_resolveResource(pResource)),
+        _mapRowIdx2ViewRowIdx(nullptr),
+        _mRowChangeSeq(parent._mRowChangeSeq),
+        _mHasParentView(true)
+    {}
+
+    // copy of a view, using the memory resource of 'other'. The reverse map is built again on first lookup by row name.
+    _ViewDocument(const _ViewDocument& other)
+      : _document(other._document),     _mData(other._mData),
+        _mapViewRowIdx2RowIdx(other._mapViewRowIdx2RowIdx, other._mapViewRowIdx2RowIdx.get_allocator()),
+        _mapRowIdx2ViewRowIdx(nullptr),
+        _mRowChangeSeq(other._mRowChangeSeq),
+        _mHasParentView(other._mHasParentView)
     {}
 
+    _ViewDocument(_ViewDocument&& other) noexcept
+      : _document(other._document),     _mData(other._mData),
+        _mapViewRowIdx2RowIdx(std::move(other._mapViewRowIdx2RowIdx)),
+        _mapRowIdx2ViewRowIdx(other._mapRowIdx2ViewRowIdx.exchange(nullptr)),
+        _mRowChangeSeq(other._mRowChangeSeq),
+        _mHasParentView(other._mHasParentView)
+    {}
+
+    static std::pmr::memory_resource* _resolveResource(std::pmr::memory_resource* pResource)
+    {
+      return (pResource != nullptr) ? pResource : std::pmr::get_default_resource();
+    }
+
     /**
      * @brief   Destructor
      */
@@ -247,10 +389,188 @@ namespace rapidcsv
       //_document.Clear();
       //_mData.clear();
       _mapViewRowIdx2RowIdx.clear();
-      _mapRowIdx2ViewRowIdx.clear();
+      _resetRowIdx2ViewRowIdx();
+    }
+
+    // drops the reverse map, to be built again on next lookup by row name. Not to be called concurrently with lookups.
+    inline void _resetRowIdx2ViewRowIdx()
+    {
+      delete _mapRowIdx2ViewRowIdx.exchange(nullptr);
+    }
+
+    // calls 'pVisitRow(rowIdx)' for each source row : all rows of the Document if 'pParent' is nullptr,
+    // else the view rows of 'pParent' in its view order.
+    template< typename F >
+    inline void _forEachSourceRow(const _ViewDocument* pParent, F&& pVisitRow) const
+    {
+      if (pParent == nullptr)
+      {
+        for (size_t rowIdx = 0; rowIdx < _mData.size(); ++rowIdx)
+        {
+          pVisitRow(rowIdx);
+        }
+      } else {
+        for (const size_t rowIdx : pParent->_mapViewRowIdx2RowIdx)
+        {
+          pVisitRow(rowIdx);
+        }
+      }
+    }
+
+    // Replays the Document's row changes since the view was created or last refreshed, on the row indexes held by
+    // the view : 'pShiftRows(rowIdx, count)' is called on insert of 'count' rows at 'rowIdx' before existing rows,
+    // 'pRemoveRows(rowIdx, count)' on remove of the rows [rowIdx, rowIdx+count). The inserted and updated rows,
+    // as indexes after all changes, are returned in 'pDirtyRowIdxs' in ascending order, to be evaluated by the caller.
+    // 'pHasUpdatedRows' is set if some of those rows existed before. Returns false if the view must be re-created,
+    // i.e. some changes are no longer in the change log or all rows were reset.
+    template< typename S, typename R >
+    bool _replayRowChanges(std::vector<size_t>& pDirtyRowIdxs, bool& pHasUpdatedRows,
+                           S&& pShiftRows, R&& pRemoveRows)
+    {
+      if (_mHasParentView)
+      {
+        static const std::string errMsg("rapidcsv::_ViewDocument::Refresh() : view created from another view can't be refreshed");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : re-create it from the refreshed parent view");
+        throw std::out_of_range(errMsg);
+      }
+
+      const size_t rowChangeSeq = _mRowChangeSeq;
+      _mRowChangeSeq = _document.GetRowChangeSeq();
+      _resetRowIdx2ViewRowIdx();
+      pDirtyRowIdxs.clear();
+      pHasUpdatedRows = false;
+      if (rowChangeSeq < _document.GetRowChangeFirstSeq())
+      {
+        return false;
+      }
+
+      const std::span<const RowChange> rowChanges = _document.GetRowChanges(rowChangeSeq);
+      // row count of the Document, before each change
+      size_t rowCount = _mData.size();
+      for (const RowChange& rowChange : rowChanges)
+      {
+        switch (rowChange.mChange)
+        {
+          case ROWS_INSERTED : rowCount -= rowChange.mRowCount;  break;
+          case ROWS_REMOVED  : rowCount += rowChange.mRowCount;  break;
+          case ROWS_UPDATED  : break;
+          case ROWS_RESET    : return false;
+          default            : return false;
+        }
+      }
+
+      for (const RowChange& rowChange : rowChanges)
+      {
+        const size_t beginRowIdx = rowChange.mRowIdx;
+        const size_t endRowIdx = rowChange.mRowIdx + rowChange.mRowCount;
+        if (rowChange.mChange == ROWS_INSERTED)
+        {
+          if (beginRowIdx < rowCount)
+          {
+            pShiftRows(beginRowIdx, rowChange.mRowCount);
+            for (size_t& dirtyRowIdx : pDirtyRowIdxs)
+            {
+              if (dirtyRowIdx >= beginRowIdx)  dirtyRowIdx += rowChange.mRowCount;
+            }
+          }
+          for (size_t rowIdx = beginRowIdx; rowIdx < endRowIdx; ++rowIdx)
+          {
+            pDirtyRowIdxs.push_back(rowIdx);
+          }
+          rowCount += rowChange.mRowCount;
+        } else if (rowChange.mChange == ROWS_REMOVED) {
+          pRemoveRows(beginRowIdx, rowChange.mRowCount);
+          pDirtyRowIdxs.erase(std::remove_if(pDirtyRowIdxs.begin(), pDirtyRowIdxs.end(),
+                                             [beginRowIdx, endRowIdx](const size_t rowIdx)
+                                             { return (rowIdx >= beginRowIdx) && (rowIdx < endRowIdx); }),
+                              pDirtyRowIdxs.end());
+          for (size_t& dirtyRowIdx : pDirtyRowIdxs)
+          {
+            if (dirtyRowIdx >= endRowIdx)  dirtyRowIdx -= rowChange.mRowCount;
+          }
+          rowCount -= rowChange.mRowCount;
+        } else {
+          for (size_t rowIdx = beginRowIdx; rowIdx < endRowIdx; ++rowIdx)
+          {
+            pDirtyRowIdxs.push_back(rowIdx);
+          }
+          pHasUpdatedRows = true;
+        }
+      }
+
+      std::sort(pDirtyRowIdxs.begin(), pDirtyRowIdxs.end());
+      pDirtyRowIdxs.erase(std::unique(pDirtyRowIdxs.begin(), pDirtyRowIdxs.end()), pDirtyRowIdxs.end());
+      return true;
+    }
+
+    // view-row index of document row 'pRowIdx', negative if filtered out. The first call after creating or
+    // refreshing the view builds the reverse map. Concurrent first calls may each build one, only the first
+    // published is kept, hence concurrent const calls are safe without a lock.
+    ssize_t _getViewRowIdx(const size_t pRowIdx) const
+    {
+      const std::pmr::vector<ssize_t>* mapRowIdx2ViewRowIdx = _mapRowIdx2ViewRowIdx.load(std::memory_order_acquire);
+      if (mapRowIdx2ViewRowIdx == nullptr)
+      {
+        std::unique_ptr<std::pmr::vector<ssize_t>> built =
+          std::make_unique<std::pmr::vector<ssize_t>>(_mData.size(), -10, _mapViewRowIdx2RowIdx.get_allocator());
+        ssize_t viewRowIdx = 0;
+        for (const size_t rowIdx : _mapViewRowIdx2RowIdx)
+        {
+          if (rowIdx < built->size())
+          {
+            (*built)[rowIdx] = viewRowIdx;
+          }
+          ++viewRowIdx;
+        }
+
+        std::pmr::vector<ssize_t>* published = nullptr;
+        if (_mapRowIdx2ViewRowIdx.compare_exchange_strong(published, built.get(),
+                                                          std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          published = built.release();
+        }
+        mapRowIdx2ViewRowIdx = published;
+      }
+      // a row inserted in the Document after the view was created or refreshed is not in the view
+      return (pRowIdx < mapRowIdx2ViewRowIdx->size()) ? (*mapRowIdx2ViewRowIdx)[pRowIdx] : -10;
+    }
+
+    // calls 'pConvertCell(viewRowIdx, cell)' for each cell of column 'pColumnIdx', in view order.
+    template< typename F >
+    inline void _forEachViewColumnCell(const c_sizet_or_string auto& pColumnNameIdx, const size_t pColumnIdx,
+                                       F&& pConvertCell) const
+    {
+      size_t viewRowIdx = 0;
+      for (auto itViewRowIdx = _mapViewRowIdx2RowIdx.begin();
+           itViewRowIdx != _mapViewRowIdx2RowIdx.end(); ++itViewRowIdx, ++viewRowIdx)
+      {
+        const rapidcsv::Document::t_dataRow& row = _mData.at(*itViewRowIdx);
+        if (pColumnIdx < row.size())
+        {
+          pConvertCell(viewRowIdx, row[pColumnIdx]);
+        } else {
+          static const std::string errMsg("rapidcsv::_ViewDocument::GetViewColumn() : requested column index is more than row.size()");
+          RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnNameIdx='" << pColumnNameIdx << "' , pColumnIdx=" << pColumnIdx << " , row.size()=" << row.size());
+          #if FLAG_RAPIDCSV_debug_log != 1
+            (void)pColumnNameIdx;
+          #endif
+          throw std::out_of_range(errMsg);
+        }
+      }
     }
 
   public:
+    /**
+     * @brief   Get document row indexes of the view rows, in view order, without per-row checks.
+     *          Read access for query classes such as 'ExprFilterDocument' and 'GroupBy'. Only intended for internal usage.
+     * @param   pView                 view on a 'Document'.
+     * @returns document row indexes, valid until the view is refreshed.
+     */
+    static inline std::span<const size_t> _getViewRowIdxs(const _ViewDocument& pView)
+    {
+      return pView._mapViewRowIdx2RowIdx;
+    }
+
     /**
      * @brief   Get number of view rows (excluding label rows).
      * @returns view-row count.
@@ -260,6 +580,37 @@ namespace rapidcsv
       return _mapViewRowIdx2RowIdx.size();
     }
 
+    /**
+     * @brief   Get range over the view rows in view order, for use with range-for and 'std::ranges' algorithms.
+     * @tparam  T_C                   one for each of the first columns of a row, for typed access by 'RowProxy::get<I>()'.
+     *                                T can be data-type such as int, double etc ;   xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @returns 'RowRange<T_C...>', valid until the Document's structure changes or the view is refreshed.
+     */
+    template< typename ... T_C >
+    inline RowRange<T_C ...> GetViewRowRange() const
+    {
+      return RowRange<T_C ...>(_mData.data(), _mapViewRowIdx2RowIdx.data(), _mapViewRowIdx2RowIdx.size());
+    }
+
+    /**
+     * @brief   Check if rows of the Document have changed since the view was created or last refreshed.
+     * @returns true if the view is up to date with the Document.
+     */
+    inline bool IsCurrent() const
+    {
+      return _mRowChangeSeq == _document.GetRowChangeSeq();
+    }
+
+    /**
+     * @brief   Get the underlying Document of the view.
+     * @returns 'Document' object the view was created on.
+     */
+    inline const Document& GetDocument() const
+    {
+      return _document;
+    }
+
     // TODO function and unit tests  for ARGS...
     /**
      * @brief   Get column by index.
@@ -280,25 +631,56 @@ namespace rapidcsv
     std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>
     GetViewColumn(const c_sizet_or_string auto& pColumnNameIdx) const
     {
-      const size_t pColumnIdx = _document.GetColumnIdx(pColumnNameIdx);
       std::vector< typename converter::t_S2Tconv_c<T_C>::return_type > column;
-      for (auto itViewRowIdx = _mapViewRowIdx2RowIdx.begin();
-           itViewRowIdx != _mapViewRowIdx2RowIdx.end(); ++itViewRowIdx)
+      GetViewColumn<T_C>(pColumnNameIdx, column);
+      return column;
+    }
+
+    /**
+     * @brief   Get column by index, into a caller-owned vector. The vector is cleared and refilled,
+     *          hence it's allocated capacity is reused over repeated calls.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'vector<R>' to be filled with column data, in view order.
+     *                                By default, R is usually same type as T.
+     *                                Else if 'C = converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    void GetViewColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                       std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>& pColumn) const
+    {
+      const size_t columnIdx = _document.GetColumnIdx(pColumnNameIdx);
+      pColumn.clear();
+      pColumn.reserve(_mapViewRowIdx2RowIdx.size());
+      _forEachViewColumnCell(pColumnNameIdx, columnIdx,
+                             [&pColumn](const size_t, const std::string& pCell)
+                             { pColumn.push_back(_S2Tdispatch<T_C>(pCell)); });
+    }
+
+    /**
+     * @brief   Get column by index, into a caller-owned span of size 'GetViewRowCount()'.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'span<R>' to be filled with column data, in view order.
+     *                                By default, R is usually same type as T.
+     *                                Else if 'C = converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    void GetViewColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                       const std::span<typename converter::t_S2Tconv_c<T_C>::return_type> pColumn) const
+    {
+      const size_t columnIdx = _document.GetColumnIdx(pColumnNameIdx);
+      if (pColumn.size() != _mapViewRowIdx2RowIdx.size())
       {
-        const size_t rowIdx = static_cast<size_t>(*itViewRowIdx);
-        const rapidcsv::Document::t_dataRow& row = _mData.at(rowIdx);
-        if (pColumnIdx < row.size())
-        {
-          const std::string& cellStrVal = row.at(pColumnIdx);
-          typename converter::t_S2Tconv_c<T_C>::return_type val = converter::t_S2Tconv_c<T_C>::ToVal(cellStrVal);
-          column.push_back(val);
-        } else {
-          static const std::string errMsg("rapidcsv::_ViewDocument::GetViewColumn() : requested column index is more than row.size()");
-          RAPIDCSV_DEBUG_LOG(errMsg << " : pColumnNameIdx='" << pColumnNameIdx << "' , pColumnIdx=" << pColumnIdx << " , row.size()=" << row.size());
-          throw std::out_of_range(errMsg);
-        }
+        static const std::string errMsg("rapidcsv::_ViewDocument::GetViewColumn(pColumnNameIdx, pColumn) : span size is not same as number of view rows");
+        RAPIDCSV_DEBUG_LOG(errMsg << " : span size=" << pColumn.size() << " , number of view rows=" << _mapViewRowIdx2RowIdx.size());
+        throw std::out_of_range(errMsg);
       }
-      return column;
+      _forEachViewColumnCell(pColumnNameIdx, columnIdx,
+                             [&pColumn](const size_t pViewRowIdx, const std::string& pCell)
+                             { pColumn[pViewRowIdx] = _S2Tdispatch<T_C>(pCell); });
     }
 
     /**
@@ -328,12 +710,14 @@ namespace rapidcsv
      * @returns zero-based row index.
      *          After removal of all filtered rows, the new row-index of remaining rows.
      *          If 'pRowName' belongs to a filtered out row, then 'out_of_range' error is thrown.
+     *          The first lookup by name after creating or refreshing the view allocates a map of
+     *          size 'Document::GetRowCount()'; concurrent calls are safe.
      */
-    inline size_t GetViewRowIdx(const std::string& pRowName) const
+    inline size_t GetViewRowIdx(const std::string_view pRowName) const
     {
       const size_t rowIdx = _document.GetRowIdx(pRowName);
 
-      ssize_t viewRowIdx = _mapRowIdx2ViewRowIdx.at(rowIdx);
+      const ssize_t viewRowIdx = _getViewRowIdx(rowIdx);
       if (viewRowIdx < 0)
       {
         static const std::string errMsg("rapidcsv::_ViewDocument::GetViewRowIdx(pRowName) : row filtered out");
@@ -350,12 +734,14 @@ namespace rapidcsv
      * @returns zero-based row index.
      *          This is the row-index as seen in the underlying CSV file.
      *          If 'pRowName' belongs to a filtered out row, then 'out_of_range' error is thrown.
+     *          The first lookup by name after creating or refreshing the view allocates a map of
+     *          size 'Document::GetRowCount()'; concurrent calls are safe.
      */
-    inline size_t GetDocumentRowIdx(const std::string& pRowName) const
+    inline size_t GetDocumentRowIdx(const std::string_view pRowName) const
     {
       const size_t rowIdx = _document.GetRowIdx(pRowName);
 
-      ssize_t viewRowIdx = _mapRowIdx2ViewRowIdx.at(rowIdx);
+      const ssize_t viewRowIdx = _getViewRowIdx(rowIdx);
       if (viewRowIdx < 0)
       {
         static const std::string errMsg("rapidcsv::_ViewDocument::GetDocumentRowIdx(pRowName) : row filtered out");
@@ -443,6 +829,35 @@ namespace rapidcsv
       return _document.GetRow_VecStr(docRowIdx);
     }
 
+    /**
+     * @brief   Get row either by it's index or name, as views of the cells. No cell is copied.
+     *          The views are valid until the underlying document is modified.
+     * @param   pRowName_ViewRowIdx   row-name or zero-based row-view-index(i.e index after removing filtered rows and/or sorting the csv-rows).
+     * @returns 'vector<string_view>' of row data from view.
+     *          If 'pRowName_ViewRowIdx' belongs to a filtered out row, then 'out_of_range' error is thrown.
+     */
+    inline std::vector<std::string_view>
+    GetViewRow_VecStrView(const c_sizet_or_string auto& pRowName_ViewRowIdx) const
+    {
+      const size_t docRowIdx = GetDocumentRowIdx(pRowName_ViewRowIdx);
+      return _document.GetRow_VecStrView(docRowIdx);
+    }
+
+    /**
+     * @brief   Get row either by it's index or name, as views of the cells, into a caller-owned vector.
+     *          The vector's allocated capacity is reused over repeated calls. The views are valid until
+     *          the underlying document is modified.
+     * @param   pRowName_ViewRowIdx   row-name or zero-based row-view-index(i.e index after removing filtered rows and/or sorting the csv-rows).
+     * @param   pRow                  'vector<string_view>' to be filled with row data from view.
+     */
+    inline void
+    GetViewRow_VecStrView(const c_sizet_or_string auto& pRowName_ViewRowIdx,
+                          std::vector<std::string_view>& pRow) const
+    {
+      const size_t docRowIdx = GetDocumentRowIdx(pRowName_ViewRowIdx);
+      _document.GetRow_VecStrView(docRowIdx, pRow);
+    }
+
     // TODO function and unit tests  for ARGS...
     /**
      * @brief   Get cell by column index and row-name/zero-based-row-view-index.
@@ -512,24 +927,27 @@ namespace rapidcsv
      * @brief   Constructor. After excluding the rows as defined by 'evaluateBooleanExpression',
      *          creates bi-directional map between view-rows and actual-csv-rows.
      * @param   document               'Document' object with CSV data.
+     * @param   pResource              memory resource for the view's row maps, if nullptr the
+     *                                 default memory resource is used.
      */
-    explicit FilterDocument(const Document& document)
-      : _ViewDocument(document)
+    explicit FilterDocument(const Document& document, std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(document, pResource)
     {
-      size_t rowIdx = 0;
-      ssize_t viewRowIdx = 0;
-      for (auto itRow  = _mData.begin();
-                itRow != _mData.end(); ++itRow, ++rowIdx)
-      {
-        if (evaluateBooleanExpression(*itRow))
-        {
-          _mapViewRowIdx2RowIdx.push_back(rowIdx);
-          _mapRowIdx2ViewRowIdx.push_back(viewRowIdx);
-          ++viewRowIdx;
-        } else {
-          _mapRowIdx2ViewRowIdx.push_back(-10);
-        }
-      }
+      _filterRows(nullptr);
+    }
+
+    /**
+     * @brief   Constructor. Refines an existing view : only the view rows of 'parent' are visited, and
+     *          the rows not excluded by 'evaluateBooleanExpression' keep the view order of 'parent'.
+     *          The new view refers to the Document of 'parent', but not to 'parent' itself.
+     * @param   parent                 view to refine, such as a 'FilterDocument' or 'FilterSortDocument'.
+     * @param   pResource              memory resource for the view's row maps, if nullptr the
+     *                                 default memory resource is used.
+     */
+    explicit FilterDocument(const _ViewDocument& parent, std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(parent, pResource)
+    {
+      _filterRows(&parent);
     }
 
     /**
@@ -537,6 +955,83 @@ namespace rapidcsv
      */
     virtual ~FilterDocument()
     {}
+
+    /**
+     * @brief   Bring the view up to date with the row changes of the Document since the view was created or
+     *          last refreshed, as recorded in the Document's row change log. Only inserted and updated rows
+     *          are evaluated, e.g. appending 'Δ' rows evaluates 'Δ' rows. Insert or remove of rows before
+     *          view rows shifts the row indexes of those view rows, which costs O(n) for a view of 'n' rows.
+     *          The view is re-created if the changes are no longer in the change log, or on 'Clear()', 'Load()'
+     *          or insert/remove of columns.
+     *          If the view was created from another view, then 'out_of_range' error is thrown.
+     */
+    void Refresh()
+    {
+      std::vector<size_t> dirtyRowIdxs;
+      bool hasUpdatedRows = false;
+      // view rows are in document row order
+      auto shiftRows = [this](const size_t pRowIdx, const size_t pCount)
+      {
+        for (auto itRowIdx  = std::lower_bound(_mapViewRowIdx2RowIdx.begin(), _mapViewRowIdx2RowIdx.end(), pRowIdx);
+                  itRowIdx != _mapViewRowIdx2RowIdx.end(); ++itRowIdx)
+        {
+          *itRowIdx += pCount;
+        }
+      };
+      auto removeRows = [this](const size_t pRowIdx, const size_t pCount)
+      {
+        auto itRowIdx = _mapViewRowIdx2RowIdx.erase(
+                          std::lower_bound(_mapViewRowIdx2RowIdx.begin(), _mapViewRowIdx2RowIdx.end(), pRowIdx),
+                          std::lower_bound(_mapViewRowIdx2RowIdx.begin(), _mapViewRowIdx2RowIdx.end(), pRowIdx + pCount));
+        for (; itRowIdx != _mapViewRowIdx2RowIdx.end(); ++itRowIdx)
+        {
+          *itRowIdx -= pCount;
+        }
+      };
+
+      if (!_replayRowChanges(dirtyRowIdxs, hasUpdatedRows, shiftRows, removeRows))
+      {
+        _mapViewRowIdx2RowIdx.clear();
+        _filterRows(nullptr);
+        return;
+      }
+
+      if (hasUpdatedRows)
+      {
+        _mapViewRowIdx2RowIdx.erase(std::remove_if(_mapViewRowIdx2RowIdx.begin(), _mapViewRowIdx2RowIdx.end(),
+                                                   [&dirtyRowIdxs](const size_t rowIdx)
+                                                   { return std::binary_search(dirtyRowIdxs.begin(), dirtyRowIdxs.end(), rowIdx); }),
+                                    _mapViewRowIdx2RowIdx.end());
+      }
+
+      const ssize_t firstNewViewRowIdx = static_cast<ssize_t>(_mapViewRowIdx2RowIdx.size());
+      for (const size_t rowIdx : dirtyRowIdxs)
+      {
+        if (evaluateBooleanExpression(_mData[rowIdx]))
+        {
+          _mapViewRowIdx2RowIdx.push_back(rowIdx);
+        }
+      }
+      const auto itFirstNew = _mapViewRowIdx2RowIdx.begin() + firstNewViewRowIdx;
+      // appended rows are already in order
+      if ( (itFirstNew != _mapViewRowIdx2RowIdx.begin()) && (itFirstNew != _mapViewRowIdx2RowIdx.end()) &&
+           (*itFirstNew < *std::prev(itFirstNew)) )
+      {
+        std::inplace_merge(_mapViewRowIdx2RowIdx.begin(), itFirstNew, _mapViewRowIdx2RowIdx.end());
+      }
+    }
+
+  private:
+    void _filterRows(const _ViewDocument* pParent)
+    {
+      _forEachSourceRow(pParent, [this](const size_t rowIdx)
+      {
+        if (evaluateBooleanExpression(_mData[rowIdx]))
+        {
+          _mapViewRowIdx2RowIdx.push_back(rowIdx);
+        }
+      });
+    }
   };
 
 /*  not needed
@@ -574,8 +1069,37 @@ namespace rapidcsv
     using t_sortKey = typename SortKeyFactory<SPtypes ...>::t_sortKey;
 
     const t_sortPredicate _sortPredicate;
-    std::map<t_sortKey, size_t,
-             t_sortPredicate > _sortedData;
+
+  public:
+    /**
+     * @brief   sort-key and zero-based document row index, of a view row.
+     */
+    using t_sortEntry = std::pair<t_sortKey, size_t>;
+    /**
+     * @brief   iterator over the sort-keys, in view row order.
+     */
+    using t_sortIterator = typename std::pmr::vector<t_sortEntry>::const_iterator;
+
+  private:
+    // sorted on key, i.e. index in the vector is the view row index
+    std::pmr::vector<t_sortEntry> _sortedData;
+    // for each entry of '_sortedData', number of rows having the sort-key; may over-count after 'Refresh()'
+    std::pmr::vector<size_t> _keyRowCounts;
+    // needed to create sort-keys of rows changed later, on 'Refresh()'
+    const std::tuple<SPtypes ...> _sortParams;
+
+    t_sortIterator _findSortKey(const t_sortKey& pRowKey) const
+    {
+      const t_sortIterator itEntry =
+        std::lower_bound(_sortedData.begin(), _sortedData.end(), pRowKey,
+                         [this](const t_sortEntry& entry, const t_sortKey& rowKey)
+                         { return _sortPredicate(entry.first, rowKey); });
+      if ( (itEntry != _sortedData.end()) && !_sortPredicate(pRowKey, itEntry->first) )
+      {
+        return itEntry;
+      }
+      return _sortedData.end();
+    }
 
   public:
 
@@ -585,6 +1109,7 @@ namespace rapidcsv
     virtual ~FilterSortDocument()
     {
       _sortedData.clear();
+      _keyRowCounts.clear();
     }
 
     /**
@@ -592,36 +1117,374 @@ namespace rapidcsv
      *          and sorting the rows based on SortPrams;
      *          creates bi-directional map between view-rows and actual-csv-rows.
      * @param   document               'Document' object with CSV data.
+     * @param   spArgs                 sort parameters, one for each of 'SPtypes'.
+     * @param   pResource              memory resource for the view's row maps and sorted keys, if nullptr
+     *                                 the default memory resource is used.
+     */
+    explicit FilterSortDocument(const Document& document, const SPtypes& ... spArgs,
+                                std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(document, pResource), _sortPredicate(),
+        _sortedData(_resolveResource(pResource)),
+        _keyRowCounts(_resolveResource(pResource)),
+        _sortParams(spArgs ...)
+    {
+      _sortRows(nullptr);
+    }
+
+    /**
+     * @brief   Constructor. Refines an existing view : only the view rows of 'parent' are visited,
+     *          filtered by 'evaluateBooleanExpression' and sorted based on SortParams. Rows with equal
+     *          sort-keys collapse to the last of them in the view order of 'parent'.
+     *          The new view refers to the Document of 'parent', but not to 'parent' itself.
+     * @param   parent                 view to refine, such as a 'FilterDocument' or 'FilterSortDocument'.
+     * @param   spArgs                 sort parameters, one for each of 'SPtypes'.
+     * @param   pResource              memory resource for the view's row maps and sorted keys, if nullptr
+     *                                 the default memory resource is used.
+     */
+    explicit FilterSortDocument(const _ViewDocument& parent, const SPtypes& ... spArgs,
+                                std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(parent, pResource), _sortPredicate(),
+        _sortedData(_resolveResource(pResource)),
+        _keyRowCounts(_resolveResource(pResource)),
+        _sortParams(spArgs ...)
+    {
+      _sortRows(&parent);
+    }
+
+    /**
+     * @brief   Bring the view up to date with the row changes of the Document since the view was created or
+     *          last refreshed, as recorded in the Document's row change log. Only inserted and updated rows
+     *          are evaluated and their sort-keys created, each looked up by binary search. As view rows are held
+     *          in one sorted vector, new view rows are sorted among themselves and merged into it in one pass from
+     *          the first insert position, and the view-row map is rewritten from there only. Hence for a view of
+     *          'n' rows, 'Δ' new view rows cost O(Δ log n + m), where 'm' is the number of view rows sorting
+     *          after the first new one, i.e. O(Δ log n) when appending rows with the greatest sort-keys. Insert
+     *          or remove of rows before existing rows, or update of view rows, walk all view rows, i.e. O(n).
+     *          The view is re-created if the changes are no longer in the change log, on 'Clear()', 'Load()'
+     *          or insert/remove of columns, or if a removed or re-keyed view row may have had other rows with
+     *          its sort-key, as the next of them can't be found without a scan.
+     *          If the view was created from another view, then 'out_of_range' error is thrown.
      */
-    explicit FilterSortDocument(const Document& document, const SPtypes& ... spArgs)
-      : _ViewDocument(document), _sortPredicate(), _sortedData(_sortPredicate)
+    void Refresh()
     {
-      size_t rowIdx = 0;
-      for (auto itRow  = _mData.begin();
-                itRow != _mData.end(); ++itRow, ++rowIdx)
+      std::vector<size_t> dirtyRowIdxs;
+      bool hasUpdatedRows = false;
+      bool isRecreate = false;
+      // view rows before this index are unchanged, as well as their document row indexes
+      size_t firstChangedViewRowIdx = std::numeric_limits<size_t>::max();
+      auto shiftRows = [this, &firstChangedViewRowIdx](const size_t pRowIdx, const size_t pCount)
       {
-        if (evaluateBooleanExpression(*itRow))
+        firstChangedViewRowIdx = 0;
+        for (t_sortEntry& entry : _sortedData)
         {
-          t_sortKey rowIndexValues  = SortKeyFactory<SPtypes ...>::createSortKey((*itRow), spArgs ...);
-          _sortedData[rowIndexValues] = rowIdx;
+          if (entry.second >= pRowIdx)  entry.second += pCount;
         }
-        _mapRowIdx2ViewRowIdx.push_back(-10);
-      }
+      };
+      auto removeRows = [this, &isRecreate, &firstChangedViewRowIdx](const size_t pRowIdx, const size_t pCount)
+      {
+        firstChangedViewRowIdx = 0;
+        _removeEntries([this, pRowIdx, pCount, &isRecreate](t_sortEntry& entry, const size_t keyRowCount)
+        {
+          if (entry.second >= (pRowIdx + pCount))
+          {
+            entry.second -= pCount;
+          } else if (entry.second >= pRowIdx) {
+            isRecreate = isRecreate || (keyRowCount > 1);
+            return true;
+          }
+          return false;
+        });
+      };
 
-      ssize_t viewRowIdx = 0;
-      for (auto itMap  = _sortedData.begin();
-                itMap != _sortedData.end(); ++itMap, ++viewRowIdx)
+      if (!_replayRowChanges(dirtyRowIdxs, hasUpdatedRows, shiftRows, removeRows) || isRecreate)
       {
-        rowIdx = itMap->second;
-        _mapViewRowIdx2RowIdx.push_back(rowIdx);
-        _mapRowIdx2ViewRowIdx.at(rowIdx) = viewRowIdx;
-        // std::cout << "rowIdx("<< rowIdx <<") <-> viewRowIdx(" << viewRowIdx << ")" << std::endl;
+        _recreate();
+        return;
       }
-    }
 
-    /*
-     * GetColumn_IndexKey(columnName) does not make sense, as information retrived is identified by
-     * index-key of type std::tuple< Ts... > . This is applicable for fetching row and cell data,
+      // view rows which were updated : kept if the sort-key is unchanged, else evaluated as a new row
+      std::vector<bool> isDone(dirtyRowIdxs.size(), false);
+      if (hasUpdatedRows)
+      {
+        firstChangedViewRowIdx = 0;
+        _removeEntries([this, &dirtyRowIdxs, &isDone, &isRecreate](t_sortEntry& entry, const size_t keyRowCount)
+        {
+          const auto itDirty = std::lower_bound(dirtyRowIdxs.begin(), dirtyRowIdxs.end(), entry.second);
+          if ( (itDirty == dirtyRowIdxs.end()) || (*itDirty != entry.second) )
+          {
+            return false;
+          }
+
+          const Document::t_dataRow& row = _mData[entry.second];
+          if (evaluateBooleanExpression(row))
+          {
+            t_sortKey rowKey = _createSortKey(row);
+            if ( !_sortPredicate(rowKey, entry.first) && !_sortPredicate(entry.first, rowKey) )
+            {
+              // equivalent keys may still differ in value, the cached key is of the view row
+              entry.first = std::move(rowKey);
+              isDone[static_cast<size_t>(itDirty - dirtyRowIdxs.begin())] = true;
+              return false;
+            }
+          }
+          isRecreate = isRecreate || (keyRowCount > 1);
+          return true;
+        });
+        if (isRecreate)
+        {
+          _recreate();
+          return;
+        }
+      }
+
+      // rows of sort-keys already in the view update it in place, the others are batched
+      std::vector<t_sortEntry> newEntries;
+      for (size_t dirtyIdx = 0; dirtyIdx < dirtyRowIdxs.size(); ++dirtyIdx)
+      {
+        const size_t rowIdx = dirtyRowIdxs[dirtyIdx];
+        const Document::t_dataRow& row = _mData[rowIdx];
+        if (isDone[dirtyIdx] || !evaluateBooleanExpression(row))
+        {
+          continue;
+        }
+
+        t_sortKey rowKey = _createSortKey(row);
+        const auto itEntry =
+          std::lower_bound(_sortedData.begin(), _sortedData.end(), rowKey,
+                           [this](const t_sortEntry& entry, const t_sortKey& key)
+                           { return _sortPredicate(entry.first, key); });
+        if ( (itEntry != _sortedData.end()) && !_sortPredicate(rowKey, itEntry->first) )
+        {
+          const size_t entryIdx = static_cast<size_t>(itEntry - _sortedData.begin());
+          // last of the rows with equal sort-keys is the view row
+          if (rowIdx > itEntry->second)
+          {
+            itEntry->first  = std::move(rowKey);
+            itEntry->second = rowIdx;
+            firstChangedViewRowIdx = std::min(firstChangedViewRowIdx, entryIdx);
+          }
+          ++_keyRowCounts[entryIdx];
+        } else {
+          newEntries.emplace_back(std::move(rowKey), rowIdx);
+        }
+      }
+      if (!newEntries.empty())
+      {
+        firstChangedViewRowIdx = std::min(firstChangedViewRowIdx, _mergeNewEntries(newEntries));
+      }
+      _mapViewRows(firstChangedViewRowIdx);
+    }
+
+  private:
+    inline t_sortKey _createSortKey(const Document::t_dataRow& pRowData) const
+    {
+      return std::apply([&pRowData](const SPtypes& ... spArgs)
+                        { return SortKeyFactory<SPtypes ...>::createSortKey(pRowData, spArgs ...); },
+                        _sortParams);
+    }
+
+    // erases the entries for which 'pIsRemoved(entry, keyRowCount)' is true, keeping the order of the others.
+    template< typename F >
+    void _removeEntries(F&& pIsRemoved)
+    {
+      size_t keepIdx = 0;
+      for (size_t entryIdx = 0; entryIdx < _sortedData.size(); ++entryIdx)
+      {
+        if (pIsRemoved(_sortedData[entryIdx], _keyRowCounts[entryIdx]))
+        {
+          continue;
+        }
+        if (keepIdx != entryIdx)
+        {
+          _sortedData[keepIdx] = std::move(_sortedData[entryIdx]);
+          _keyRowCounts[keepIdx] = _keyRowCounts[entryIdx];
+        }
+        ++keepIdx;
+      }
+      _sortedData.erase(_sortedData.begin() + static_cast<ssize_t>(keepIdx), _sortedData.end());
+      _keyRowCounts.erase(_keyRowCounts.begin() + static_cast<ssize_t>(keepIdx), _keyRowCounts.end());
+    }
+
+    void _recreate()
+    {
+      _sortedData.clear();
+      _keyRowCounts.clear();
+      _sortRows(nullptr);
+    }
+
+    // sorts and collapses 'pNewEntries', whose sort-keys are not in the view, in document row order; then
+    // merges them into '_sortedData' in one pass from the first insert position, which is returned.
+    size_t _mergeNewEntries(std::vector<t_sortEntry>& pNewEntries)
+    {
+      std::stable_sort(pNewEntries.begin(), pNewEntries.end(),
+                       [this](const t_sortEntry& lhs, const t_sortEntry& rhs)
+                       { return _sortPredicate(lhs.first, rhs.first); });
+      std::vector<size_t> newKeyRowCounts;
+      auto itKeep = pNewEntries.begin();
+      for (auto itEntry = pNewEntries.begin(); itEntry != pNewEntries.end(); ++itEntry)
+      {
+        // rows with equal sort-keys collapse to the last of them
+        if ( (itKeep != pNewEntries.begin()) && !_sortPredicate(std::prev(itKeep)->first, itEntry->first) )
+        {
+          *std::prev(itKeep) = std::move(*itEntry);
+          ++newKeyRowCounts.back();
+          continue;
+        }
+        if (itKeep != itEntry)
+        {
+          *itKeep = std::move(*itEntry);
+        }
+        ++itKeep;
+        newKeyRowCounts.push_back(1);
+      }
+      pNewEntries.erase(itKeep, pNewEntries.end());
+
+      const size_t firstIdx = static_cast<size_t>(
+        std::lower_bound(_sortedData.begin(), _sortedData.end(), pNewEntries.front().first,
+                         [this](const t_sortEntry& entry, const t_sortKey& key)
+                         { return _sortPredicate(entry.first, key); }) - _sortedData.begin());
+
+      // merged tail of the view, sort-keys of new entries differ from those of the view
+      std::vector<t_sortEntry> tailEntries;
+      std::vector<size_t> tailKeyRowCounts;
+      tailEntries.reserve(_sortedData.size() - firstIdx + pNewEntries.size());
+      tailKeyRowCounts.reserve(tailEntries.capacity());
+      size_t oldIdx = firstIdx;
+      size_t newIdx = 0;
+      while ( (oldIdx < _sortedData.size()) || (newIdx < pNewEntries.size()) )
+      {
+        if ( (newIdx < pNewEntries.size()) &&
+             ( (oldIdx == _sortedData.size()) || _sortPredicate(pNewEntries[newIdx].first, _sortedData[oldIdx].first) ) )
+        {
+          tailEntries.push_back(std::move(pNewEntries[newIdx]));
+          tailKeyRowCounts.push_back(newKeyRowCounts[newIdx]);
+          ++newIdx;
+        } else {
+          tailEntries.push_back(std::move(_sortedData[oldIdx]));
+          tailKeyRowCounts.push_back(_keyRowCounts[oldIdx]);
+          ++oldIdx;
+        }
+      }
+
+      _sortedData.erase(_sortedData.begin() + static_cast<ssize_t>(firstIdx), _sortedData.end());
+      _sortedData.insert(_sortedData.end(), std::make_move_iterator(tailEntries.begin()),
+                         std::make_move_iterator(tailEntries.end()));
+      _keyRowCounts.erase(_keyRowCounts.begin() + static_cast<ssize_t>(firstIdx), _keyRowCounts.end());
+      _keyRowCounts.insert(_keyRowCounts.end(), tailKeyRowCounts.begin(), tailKeyRowCounts.end());
+      return firstIdx;
+    }
+
+    // rewrites the view-row map from view row 'pFirstViewRowIdx' on, the view rows before it are unchanged.
+    void _mapViewRows(const size_t pFirstViewRowIdx = 0)
+    {
+      const size_t firstViewRowIdx = std::min(pFirstViewRowIdx, _sortedData.size());
+      _mapViewRowIdx2RowIdx.resize(_sortedData.size());
+      for (size_t viewRowIdx = firstViewRowIdx; viewRowIdx < _sortedData.size(); ++viewRowIdx)
+      {
+        _mapViewRowIdx2RowIdx[viewRowIdx] = _sortedData[viewRowIdx].second;
+      }
+    }
+
+    void _sortRows(const _ViewDocument* pParent)
+    {
+      _forEachSourceRow(pParent, [this](const size_t rowIdx)
+      {
+        const Document::t_dataRow& row = _mData[rowIdx];
+        if (evaluateBooleanExpression(row))
+        {
+          _sortedData.emplace_back(_createSortKey(row), rowIdx);
+        }
+      });
+
+      std::stable_sort(_sortedData.begin(), _sortedData.end(),
+                       [this](const t_sortEntry& lhs, const t_sortEntry& rhs)
+                       { return _sortPredicate(lhs.first, rhs.first); });
+      // rows with equal sort-keys collapse to the last of them, as sort-key is the index
+      auto itKeep = _sortedData.begin();
+      size_t keyRowCount = 0;
+      for (auto itEntry  = _sortedData.begin();
+                itEntry != _sortedData.end(); ++itEntry)
+      {
+        ++keyRowCount;
+        const auto itNext = std::next(itEntry);
+        if ( (itNext == _sortedData.end()) || _sortPredicate(itEntry->first, itNext->first) )
+        {
+          if (itKeep != itEntry)
+          {
+            *itKeep = std::move(*itEntry);
+          }
+          ++itKeep;
+          _keyRowCounts.push_back(keyRowCount);
+          keyRowCount = 0;
+        }
+      }
+      _sortedData.erase(itKeep, _sortedData.end());
+
+      _mapViewRows();
+    }
+
+    // calls 'pOnKey(std::integral_constant<size_t, I>)' for the first sort-key component 'I' which caches
+    // column 'pColumnIdx' converted by 'T_C', i.e. same column and same conversion class; returns false if
+    // there is none, or if the view is not current, as then the cached keys may be older than the cells.
+    template< typename T_C, size_t I = 0, typename F >
+    bool _visitSortKeyColumn(const size_t pColumnIdx, F&& pOnKey) const
+    {
+      if constexpr (I < sizeof...(SPtypes))
+      {
+        using t_sortParams = std::tuple_element_t<I, std::tuple<SPtypes ...>>;
+        if constexpr ( std::is_same_v<typename t_sortParams::S2Tconv_type, converter::t_S2Tconv_c<T_C>> &&
+                       requires (const t_sortParams& sp) { sp.getColumnIndex(); } )
+        {
+          if ( (std::get<I>(_sortParams).getColumnIndex() == pColumnIdx) && IsCurrent() )
+          {
+            pOnKey(std::integral_constant<size_t, I>{});
+            return true;
+          }
+        }
+        return _visitSortKeyColumn<T_C, I + 1>(pColumnIdx, std::forward<F>(pOnKey));
+      } else {
+        (void)pColumnIdx;
+        (void)pOnKey;
+        return false;
+      }
+    }
+
+    template< typename T_C >
+    typename converter::t_S2Tconv_c<T_C>::return_type
+    _getSortEntryCell(const size_t pColumnIdx, const t_sortEntry& pEntry) const
+    {
+      std::optional<typename converter::t_S2Tconv_c<T_C>::return_type> cell;
+      _visitSortKeyColumn<T_C>(pColumnIdx, [&cell, &pEntry](const auto pKeyIdx)
+                               { cell.emplace(std::get<decltype(pKeyIdx)::value>(pEntry.first)); });
+      if (cell.has_value())
+      {
+        return std::move(*cell);
+      }
+      return _document.GetCell< converter::t_S2Tconv_c<T_C> >(pColumnIdx, pEntry.second);
+    }
+
+    template< typename ... T_C, size_t ... I >
+    inline std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
+    _getSortEntryRow(const t_sortEntry& pEntry, std::index_sequence<I ...>) const
+    {
+      return std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>{ _getSortEntryCell<T_C>(I, pEntry) ... };
+    }
+
+    inline size_t _toViewRowIdx(const c_sizet_or_string auto& pRowName_ViewRowIdx) const
+    {
+      if constexpr (std::is_convertible_v<decltype(pRowName_ViewRowIdx), size_t>)
+      {
+        return static_cast<size_t>(pRowName_ViewRowIdx);
+      } else {
+        return GetViewRowIdx(pRowName_ViewRowIdx);
+      }
+    }
+
+  public:
+
+    /*
+     * GetColumn_IndexKey(columnName) does not make sense, as information retrived is identified by
+     * index-key of type std::tuple< Ts... > . This is applicable for fetching row and cell data,
      * but does not make any sense to fetch column data, using this index-key.
      *
      * Note that `GetViewColumn(...)` will get the column in the sorted order specified by
@@ -630,7 +1493,8 @@ namespace rapidcsv
      */
 
     /**
-     * @brief   Get row either by it's index or name.
+     * @brief   Get row either by it's index or name. Cells of sort columns converted by the
+     *          SortParams' conversion are read from the cached sort-key.
      * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
      *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
      * @param   pRowKey               tuple representing indexed-key to data-row.
@@ -644,16 +1508,18 @@ namespace rapidcsv
     std::tuple<typename converter::t_S2Tconv_c<T_C>::return_type ...>
     GetRow_IndexKey(const typename SortKeyFactory<SPtypes ...>::t_sortKey& pRowKey) const
     {
-      size_t docRowIdx;
-      try {
-        docRowIdx  = _sortedData.at(pRowKey);
-      } catch (std::out_of_range& err) {
+      const t_sortIterator itEntry = _findSortKey(pRowKey);
+      if (itEntry == _sortedData.end())
+      {
         static const std::string errMsg("rapidcsv::FilterSortDocument::GetRow_IndexKey(...) : rowKey not found in 'sortedKeyMap'");
-        RAPIDCSV_DEBUG_LOG(errMsg << " : For pRowKey=[" << converter::ConvertFromTuple<typename SPtypes::S2Tconv_type::return_type ...>::ToStr(pRowKey)
-                                  << "] : ERROR: " << err.what());
+        RAPIDCSV_DEBUG_LOG(errMsg << " : For pRowKey=[" << converter::ConvertFromTuple<typename SPtypes::S2Tconv_type::return_type ...>::ToStr(pRowKey) << "]");
         throw std::out_of_range(errMsg);
       }
-      return _document.GetRow< converter::t_S2Tconv_c<T_C> ... >(docRowIdx);
+      if (_mData.at(itEntry->second).size() < sizeof...(T_C))
+      {
+        return _document.GetRow< converter::t_S2Tconv_c<T_C> ... >(itEntry->second);
+      }
+      return _getSortEntryRow<T_C ...>(*itEntry, std::index_sequence_for<T_C ...>{});
     }
 
     /**
@@ -682,20 +1548,20 @@ namespace rapidcsv
     inline std::vector<std::string>
     GetRow_IndexKey_VecStr(const typename SortKeyFactory<SPtypes ...>::t_sortKey& pRowKey) const
     {
-      size_t docRowIdx;
-      try {
-        docRowIdx  = _sortedData.at(pRowKey);
-      } catch (std::out_of_range& err) {
+      const t_sortIterator itEntry = _findSortKey(pRowKey);
+      if (itEntry == _sortedData.end())
+      {
         static const std::string errMsg("rapidcsv::FilterSortDocument::GetRow_IndexKey_VecStr(...) : rowKey not found in 'sortedKeyMap'");
-        RAPIDCSV_DEBUG_LOG(errMsg << " : For pRowKey=[" << converter::ConvertFromTuple<typename SPtypes::S2Tconv_type::return_type ...>::ToStr(pRowKey)
-                                  << "] : ERROR: " << err.what());
+        RAPIDCSV_DEBUG_LOG(errMsg << " : For pRowKey=[" << converter::ConvertFromTuple<typename SPtypes::S2Tconv_type::return_type ...>::ToStr(pRowKey) << "]");
         throw std::out_of_range(errMsg);
       }
+      const size_t docRowIdx = itEntry->second;
       return _document.GetRow_VecStr(docRowIdx);
     }
 
     /**
-     * @brief   Get cell either by it's index or name.
+     * @brief   Get cell either by it's index or name. Cells of sort columns converted by the
+     *          SortParams' conversion are read from the cached sort-key.
      * @tparam  T_C                   T can be data-type such as int, double etc ;    xOR
      *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
      * @param   pColumnNameIdx        column-name or zero-based column-index.
@@ -712,16 +1578,14 @@ namespace rapidcsv
 	                   const t_sortKey& pRowKey) const
     {
       const size_t pColumnIdx = _document.GetColumnIdx(pColumnNameIdx);
-      size_t docRowIdx;
-      try {
-        docRowIdx  = _sortedData.at(pRowKey);
-      } catch (std::out_of_range& err) {
+      const t_sortIterator itEntry = _findSortKey(pRowKey);
+      if (itEntry == _sortedData.end())
+      {
         static const std::string errMsg("rapidcsv::FilterSortDocument::GetCell_IndexKey(...) : rowKey not found in 'sortedKeyMap'");
-        RAPIDCSV_DEBUG_LOG(errMsg << " : For pRowKey=[" << converter::ConvertFromTuple<typename SPtypes::S2Tconv_type::return_type ...>::ToStr(pRowKey)
-                                  << "] : ERROR: " << err.what());
+        RAPIDCSV_DEBUG_LOG(errMsg << " : For pRowKey=[" << converter::ConvertFromTuple<typename SPtypes::S2Tconv_type::return_type ...>::ToStr(pRowKey) << "]");
         throw std::out_of_range(errMsg);
       }
-      return _document.GetCell< converter::t_S2Tconv_c<T_C> >(pColumnIdx, docRowIdx);
+      return _getSortEntryCell<T_C>(pColumnIdx, *itEntry);
     }
 
     /**
@@ -744,6 +1608,223 @@ namespace rapidcsv
     {
       return GetCell_IndexKey< converter::S2TwrapperFunction<T, CONV_S2T> >( pColumnNameIdx, pRowKey);
     }
+
+    using _ViewDocument::GetViewColumn;
+    using _ViewDocument::GetViewCell;
+
+    /**
+     * @brief   Get column by index. If the column is a sort column, and 'T_C' is the conversion of its
+     *          SortParams, then the converted values cached in the sort-keys are returned without conversion.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @returns 'vector<R>' of column data, in view order.
+     *          By default, R is usually same type as T.
+     *          Else if 'C = converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     */
+    template< typename T_C >
+    std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>
+    GetViewColumn(const c_sizet_or_string auto& pColumnNameIdx) const
+    {
+      std::vector< typename converter::t_S2Tconv_c<T_C>::return_type > column;
+      GetViewColumn<T_C>(pColumnNameIdx, column);
+      return column;
+    }
+
+    /**
+     * @brief   Get column by index, into a caller-owned vector. The vector is cleared and refilled.
+     *          Sort columns are copied from the cached sort-keys, as for 'GetViewColumn(pColumnNameIdx)'.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'vector<R>' to be filled with column data, in view order.
+     */
+    template< typename T_C >
+    void GetViewColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                       std::vector<typename converter::t_S2Tconv_c<T_C>::return_type>& pColumn) const
+    {
+      const size_t columnIdx = _document.GetColumnIdx(pColumnNameIdx);
+      const bool isCached = _visitSortKeyColumn<T_C>(columnIdx, [this, &pColumn](const auto pKeyIdx)
+      {
+        pColumn.clear();
+        pColumn.reserve(_sortedData.size());
+        for (const t_sortEntry& entry : _sortedData)
+        {
+          pColumn.push_back(std::get<decltype(pKeyIdx)::value>(entry.first));
+        }
+      });
+      if (!isCached)
+      {
+        _ViewDocument::GetViewColumn<T_C>(pColumnNameIdx, pColumn);
+      }
+    }
+
+    /**
+     * @brief   Get column by index, into a caller-owned span of size 'GetViewRowCount()'.
+     *          Sort columns are copied from the cached sort-keys, as for 'GetViewColumn(pColumnNameIdx)'.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column-index.
+     * @param   pColumn               'span<R>' to be filled with column data, in view order.
+     */
+    template< typename T_C >
+    void GetViewColumn(const c_sizet_or_string auto& pColumnNameIdx,
+                       const std::span<typename converter::t_S2Tconv_c<T_C>::return_type> pColumn) const
+    {
+      const size_t columnIdx = _document.GetColumnIdx(pColumnNameIdx);
+      const bool isCached = (pColumn.size() == _sortedData.size()) &&
+        _visitSortKeyColumn<T_C>(columnIdx, [this, &pColumn](const auto pKeyIdx)
+        {
+          for (size_t viewRowIdx = 0; viewRowIdx < _sortedData.size(); ++viewRowIdx)
+          {
+            pColumn[viewRowIdx] = std::get<decltype(pKeyIdx)::value>(_sortedData[viewRowIdx].first);
+          }
+        });
+      if (!isCached)
+      {
+        _ViewDocument::GetViewColumn<T_C>(pColumnNameIdx, pColumn);
+      }
+    }
+
+    /**
+     * @brief   Get cell by column index and row-name/zero-based-row-view-index. If the column is a sort column,
+     *          and 'T_C' is the conversion of its SortParams, then the value cached in the sort-key is returned.
+     * @tparam  T_C                   T can be data-type such as int, double etc ;  xOR
+     *                                C -> Conversion class satisfying concept 'c_S2Tconverter'.
+     * @param   pColumnNameIdx        column-name or zero-based column index.
+     * @param   pRowName_ViewRowIdx   row-name or zero-based row-view-index.
+     * @returns cell data of type R. By default, R is usually same type as T.
+     *          Else if 'C ≃ converter::ConvertFromStr_gNaN<T>', then 'R = std::variant<T, std::string>'.
+     *          If 'pRowName_ViewRowIdx' belongs to a filtered out row, then 'out_of_range' error is thrown.
+     */
+    template< typename T_C >
+    inline typename converter::t_S2Tconv_c<T_C>::return_type
+    GetViewCell(const c_sizet_or_string auto& pColumnNameIdx,
+                const c_sizet_or_string auto& pRowName_ViewRowIdx) const
+    {
+      const size_t columnIdx = _document.GetColumnIdx(pColumnNameIdx);
+      return _getSortEntryCell<T_C>(columnIdx, _sortedData.at(_toViewRowIdx(pRowName_ViewRowIdx)));
+    }
+
+    /**
+     * @brief   Get sort-key entries of all view rows.
+     * @returns entries (sort-key, document row index), in view row order.
+     */
+    inline std::span<const t_sortEntry> GetSortEntries() const
+    {
+      return std::span<const t_sortEntry>(_sortedData);
+    }
+
+    /**
+     * @brief   Get sort-key entries of the view rows whose sort-key begins with a key prefix.
+     * @tparam  T_P                   types of the leading components of 't_sortKey'.
+     * @param   pKeyPrefix            leading components of a sort-key, can be the complete sort-key.
+     * @returns pair of iterators [first, last) of entries (sort-key, document row index), in view row order.
+     *          Lookup is binary search, i.e. O(log n).
+     */
+    template< typename ... T_P >
+    std::pair<t_sortIterator, t_sortIterator>
+    EqualRange_Iter(const std::tuple<T_P ...>& pKeyPrefix) const
+    {
+      const t_sortIterator itLower =
+        std::partition_point(_sortedData.begin(), _sortedData.end(),
+                             [&pKeyPrefix](const t_sortEntry& entry)
+                             { return t_sortPredicate::comparePrefix(entry.first, pKeyPrefix) < 0; });
+      const t_sortIterator itUpper =
+        std::partition_point(itLower, _sortedData.end(),
+                             [&pKeyPrefix](const t_sortEntry& entry)
+                             { return t_sortPredicate::comparePrefix(entry.first, pKeyPrefix) == 0; });
+      return std::make_pair(itLower, itUpper);
+    }
+
+    /**
+     * @brief   Get sort-key entries of the view rows with sort-key equal to 'pRowKey'.
+     * @param   pRowKey               tuple representing indexed-key to data-row.
+     * @returns pair of iterators [first, last) of entries (sort-key, document row index), in view row order.
+     */
+    inline std::pair<t_sortIterator, t_sortIterator>
+    EqualRange_Iter(const t_sortKey& pRowKey) const
+    {
+      return EqualRange_Iter<typename SPtypes::return_type ...>(pRowKey);
+    }
+
+    /**
+     * @brief   Get view rows whose sort-key begins with a key prefix.
+     * @tparam  T_P                   types of the leading components of 't_sortKey'.
+     * @param   pKeyPrefix            leading components of a sort-key, can be the complete sort-key.
+     * @returns pair of zero-based view row indexes [first, last).
+     */
+    template< typename ... T_P >
+    std::pair<size_t, size_t>
+    EqualRange(const std::tuple<T_P ...>& pKeyPrefix) const
+    {
+      const std::pair<t_sortIterator, t_sortIterator> itRange = EqualRange_Iter(pKeyPrefix);
+      return std::make_pair(static_cast<size_t>(itRange.first  - _sortedData.begin()),
+                            static_cast<size_t>(itRange.second - _sortedData.begin()));
+    }
+
+    /**
+     * @brief   Get view rows with sort-key equal to 'pRowKey'.
+     * @param   pRowKey               tuple representing indexed-key to data-row.
+     * @returns pair of zero-based view row indexes [first, last).
+     */
+    inline std::pair<size_t, size_t>
+    EqualRange(const t_sortKey& pRowKey) const
+    {
+      return EqualRange<typename SPtypes::return_type ...>(pRowKey);
+    }
+
+    /**
+     * @brief   Get first view row whose sort-key is not ordered before a key prefix.
+     * @tparam  T_P                   types of the leading components of 't_sortKey'.
+     * @param   pKeyPrefix            leading components of a sort-key, can be the complete sort-key.
+     * @returns zero-based view row index, 'GetViewRowCount()' if none.
+     */
+    template< typename ... T_P >
+    size_t LowerBound(const std::tuple<T_P ...>& pKeyPrefix) const
+    {
+      const t_sortIterator itLower =
+        std::partition_point(_sortedData.begin(), _sortedData.end(),
+                             [&pKeyPrefix](const t_sortEntry& entry)
+                             { return t_sortPredicate::comparePrefix(entry.first, pKeyPrefix) < 0; });
+      return static_cast<size_t>(itLower - _sortedData.begin());
+    }
+
+    /**
+     * @brief   Get first view row whose sort-key is not ordered before 'pRowKey'.
+     * @param   pRowKey               tuple representing indexed-key to data-row.
+     * @returns zero-based view row index, 'GetViewRowCount()' if none.
+     */
+    inline size_t LowerBound(const t_sortKey& pRowKey) const
+    {
+      return LowerBound<typename SPtypes::return_type ...>(pRowKey);
+    }
+
+    /**
+     * @brief   Get first view row whose sort-key is ordered after a key prefix.
+     * @tparam  T_P                   types of the leading components of 't_sortKey'.
+     * @param   pKeyPrefix            leading components of a sort-key, can be the complete sort-key.
+     * @returns zero-based view row index, 'GetViewRowCount()' if none.
+     */
+    template< typename ... T_P >
+    size_t UpperBound(const std::tuple<T_P ...>& pKeyPrefix) const
+    {
+      const t_sortIterator itUpper =
+        std::partition_point(_sortedData.begin(), _sortedData.end(),
+                             [&pKeyPrefix](const t_sortEntry& entry)
+                             { return t_sortPredicate::comparePrefix(entry.first, pKeyPrefix) <= 0; });
+      return static_cast<size_t>(itUpper - _sortedData.begin());
+    }
+
+    /**
+     * @brief   Get first view row whose sort-key is ordered after 'pRowKey'.
+     * @param   pRowKey               tuple representing indexed-key to data-row.
+     * @returns zero-based view row index, 'GetViewRowCount()' if none.
+     */
+    inline size_t UpperBound(const t_sortKey& pRowKey) const
+    {
+      return UpperBound<typename SPtypes::return_type ...>(pRowKey);
+    }
   };
 
 
@@ -758,4 +1839,132 @@ namespace rapidcsv
    */
   template<c_SortParams ... SPtypes>
   using SortDocument = FilterSortDocument<selectAll, SPtypes ...>;
+
+  /**
+   * @brief     Class representing a CSV document filtered-sort-view, limited to the first 'K' rows of the
+   *            sort order. The underlying 'Document' is viewed after applying filter on rows and then keeping
+   *            the 'K' smallest rows as ordered by SortParams, using a bounded heap, i.e. O(n log K) time and
+   *            O(K) memory for sort keys. Unlike 'FilterSortDocument', rows with equal sort keys are all kept,
+   *            ordered by their document row index.
+   * @tparam    evaluateBooleanExpression         boolean function which determines row filtering.
+   * @tparam    SPtypes                           variadic list of SortParams satisfying concept 'c_SortParams',
+   *                                              one for each column to be sorted.
+   */
+  template<f_EvalBoolExpr evaluateBooleanExpression, c_SortParams ... SPtypes>
+  class FilterTopKSortDocument : public _ViewDocument
+  {
+  private:
+    using t_sortPredicate = _RowComparator<SPtypes ...>;
+    using t_sortKey = typename SortKeyFactory<SPtypes ...>::t_sortKey;
+
+    struct _KeyRow
+    {
+      t_sortKey mKey;
+      size_t    mRowIdx;
+    };
+
+  public:
+
+    /**
+     * @brief   Constructor. After excluding the rows as defined by 'evaluateBooleanExpression',
+     *          selects the first 'pLimit' rows in order of SortParams;
+     *          creates bi-directional map between view-rows and actual-csv-rows.
+     * @param   document               'Document' object with CSV data.
+     * @param   pLimit                 maximum number of view rows, i.e. 'K'.
+     * @param   spArgs                 sort parameters, one for each of 'SPtypes'.
+     * @param   pResource              memory resource for the view's row maps and sort keys, if nullptr
+     *                                 the default memory resource is used.
+     */
+    explicit FilterTopKSortDocument(const Document& document, const size_t pLimit, const SPtypes& ... spArgs,
+                                    std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(document, pResource), _mLimit(pLimit)
+    {
+      _selectRows(nullptr, spArgs ...);
+    }
+
+    /**
+     * @brief   Constructor. Refines an existing view : only the view rows of 'parent' are visited,
+     *          filtered by 'evaluateBooleanExpression' and the first 'pLimit' of them in order of
+     *          SortParams are selected. The new view refers to the Document of 'parent', but not to 'parent' itself.
+     * @param   parent                 view to refine, such as a 'FilterDocument' or 'FilterSortDocument'.
+     * @param   pLimit                 maximum number of view rows, i.e. 'K'.
+     * @param   spArgs                 sort parameters, one for each of 'SPtypes'.
+     * @param   pResource              memory resource for the view's row maps and sort keys, if nullptr
+     *                                 the default memory resource is used.
+     */
+    explicit FilterTopKSortDocument(const _ViewDocument& parent, const size_t pLimit, const SPtypes& ... spArgs,
+                                    std::pmr::memory_resource* pResource = nullptr)
+      : _ViewDocument(parent, pResource), _mLimit(pLimit)
+    {
+      _selectRows(&parent, spArgs ...);
+    }
+
+    /**
+     * @brief   Destructor
+     */
+    virtual ~FilterTopKSortDocument()
+    {}
+
+    /**
+     * @brief   Get maximum number of view rows.
+     * @returns 'K' as passed to constructor.
+     */
+    inline size_t GetLimit() const
+    {
+      return _mLimit;
+    }
+
+  private:
+    void _selectRows(const _ViewDocument* pParent, const SPtypes& ... spArgs)
+    {
+      const t_sortPredicate sortPredicate;
+      // strict weak ordering of view rows : sort key, then document row index
+      auto isBefore = [&sortPredicate](const _KeyRow& lhs, const _KeyRow& rhs)
+      {
+        if (sortPredicate(lhs.mKey, rhs.mKey)) return true;
+        if (sortPredicate(rhs.mKey, lhs.mKey)) return false;
+        return lhs.mRowIdx < rhs.mRowIdx;
+      };
+
+      // max-heap on 'isBefore', i.e. top is the last of the selected rows
+      std::pmr::vector<_KeyRow> heap(_mapViewRowIdx2RowIdx.get_allocator());
+      heap.reserve(std::min(_mLimit, (pParent == nullptr) ? _mData.size() : pParent->GetViewRowCount()));
+      _forEachSourceRow(pParent, [&](const size_t rowIdx)
+      {
+        const Document::t_dataRow& row = _mData[rowIdx];
+        if ( (_mLimit == 0) || !evaluateBooleanExpression(row) )
+        {
+          return;
+        }
+
+        _KeyRow keyRow{ SortKeyFactory<SPtypes ...>::createSortKey(row, spArgs ...), rowIdx };
+        if (heap.size() < _mLimit)
+        {
+          heap.push_back(std::move(keyRow));
+          std::push_heap(heap.begin(), heap.end(), isBefore);
+        } else if (isBefore(keyRow, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), isBefore);
+          heap.back() = std::move(keyRow);
+          std::push_heap(heap.begin(), heap.end(), isBefore);
+        }
+      });
+
+      std::sort_heap(heap.begin(), heap.end(), isBefore);
+      for (auto itHeap  = heap.begin();
+                itHeap != heap.end(); ++itHeap)
+      {
+        _mapViewRowIdx2RowIdx.push_back(itHeap->mRowIdx);
+      }
+    }
+
+    const size_t _mLimit;
+  };
+
+  /**
+   * @brief     Class representing a CSV document sort-view, limited to the first 'K' rows of the sort order.
+   * @tparam    SPtypes                           variadic list of SortParams satisfying concept 'c_SortParams',
+   *                                              one for each column to be sorted.
+   */
+  template<c_SortParams ... SPtypes>
+  using TopKSortDocument = FilterTopKSortDocument<selectAll, SPtypes ...>;
 }
@@ -0,0 +1,79 @@
+// test099.cpp - bulk append / insert of rows with row labels
+
+#include <rapidcsv/rapidcsv.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "r1,1,10,100\n"
+    "r4,4,40,400\n"
+  ;
+
+  std::string csvref =
+    "-,A,B,C\n"
+    "r0,0,0,0\n"
+    "r1,1,10,100\n"
+    "r2,2,20,200\n"
+    "r3,3,30,300\n"
+    "r4,4,40,400\n"
+    "r5,5,50,500\n"
+    "r6,6,60,600\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT),
+                           rapidcsv::SeparatorParams(',', false, false));
+
+    doc.AppendRows_VecStr({ { "5", "50", "500" }, { "6", "60", "600" } }, { "r5", "r6" });
+    doc.InsertRows<int, int, int>(1, { { 2, 20, 200 }, { 3, 30, 300 } }, { "r2", "r3" });
+    doc.InsertRows_VecStr(0, { { } }, { "r0" });
+    doc.SetRow<int, int, int>("r0", std::tuple<int, int, int>{ 0, 0, 0 });
+
+    unittest::ExpectEqual(size_t, doc.GetRowCount(), 7);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r0"), 0);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r1"), 1);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r3"), 3);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r4"), 4);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r6"), 6);
+    unittest::ExpectEqual(int, doc.GetCell<int>("B", "r3"), 30);
+    unittest::ExpectEqual(int, doc.GetCell<int>("C", "r4"), 400);
+    unittest::ExpectEqual(std::string, doc.GetRowName(5), "r5");
+
+    // duplicate names, either with existing rows or within the batch, leave the Document unchanged
+    ExpectException((doc.AppendRows_VecStr({ { "7", "70", "700" } }, { "r1" })), std::out_of_range);
+    ExpectException((doc.AppendRows_VecStr({ { "7", "70", "700" }, { "8", "80", "800" } }, { "r7", "r7" })), std::out_of_range);
+    ExpectException((doc.AppendRows_VecStr({ { "7", "70", "700" } }, { })), std::out_of_range);
+    ExpectException((doc.AppendRows<int, int, int>({ { 7, 70, 700 } }, { "" })), std::out_of_range);
+    unittest::ExpectEqual(size_t, doc.GetRowCount(), 7);
+
+    doc.Save(path);
+    std::string csvread = unittest::ReadFile(path);
+    unittest::ExpectEqual(std::string, csvref, csvread);
+
+    // without row labels
+    rapidcsv::Document doc2("", rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_MISSING, rapidcsv::FlgRowName::RN_MISSING));
+    doc2.AppendRows<int, std::string>({ { 1, "one" }, { 3, "three" } });
+    doc2.InsertRows<int, std::string>(1, { { 2, "two" } });
+    unittest::ExpectEqual(size_t, doc2.GetRowCount(), 3);
+    unittest::ExpectEqual(std::string, doc2.GetCell<std::string>(1, 1), "two");
+    unittest::ExpectEqual(int, doc2.GetCell<int>(0, 2), 3);
+    ExpectException((doc2.AppendRows_VecStr({ { "4", "four" } }, { "r4" })), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,85 @@
+// test100.cpp - label lookup by string_view, with label index kept in sync on row/column changes
+
+#include <rapidcsv/rapidcsv.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  try
+  {
+    rapidcsv::Document doc("", rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    // enough labels to force several rehash of the label index
+    const size_t numRows = 1000;
+    for (size_t i = 0; i < numRows; ++i)
+    {
+      doc.InsertRow<int, int>(i, std::tuple<int, int>{ static_cast<int>(i), static_cast<int>(i*2) }, "r" + std::to_string(i));
+    }
+    doc.SetColumnName(0, "A");
+    doc.SetColumnName(1, "B");
+
+    const std::string rowLabels = "r17 r999";
+    const std::string_view r17(rowLabels.data(), 3);
+    const std::string_view r999(rowLabels.data() + 4, 4);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx(r17), 17);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx(r999), 999);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r0"), 0);
+    unittest::ExpectEqual(size_t, doc.GetColumnIdx(std::string_view("B")), 1);
+    unittest::ExpectEqual(int, doc.GetCell<int>(std::string_view("B"), r17), 34);
+    ExpectException(doc.GetRowIdx(std::string_view("r1000")), std::out_of_range);
+    ExpectException(doc.GetColumnIdx(std::string_view("C")), std::out_of_range);
+
+    // rename : old name is no longer found
+    doc.SetRowName(17, "seventeen");
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("seventeen"), 17);
+    ExpectException(doc.GetRowIdx(r17), std::out_of_range);
+    ExpectException(doc.SetRowName(18, "seventeen"), std::out_of_range);
+    doc.SetColumnName(1, "Bee");
+    unittest::ExpectEqual(size_t, doc.GetColumnIdx("Bee"), 1);
+    ExpectException(doc.GetColumnIdx("B"), std::out_of_range);
+
+    // remove/insert rows shifts indexes of later rows
+    doc.RemoveRow("r5");
+    ExpectException(doc.GetRowIdx("r5"), std::out_of_range);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r4"), 4);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r6"), 5);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx(r999), 998);
+    unittest::ExpectEqual(int, doc.GetCell<int>("Bee", "r6"), 12);
+
+    doc.InsertRow<int, int>(5, std::tuple<int, int>{ 5, 10 }, "r5");
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r5"), 5);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r6"), 6);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx(r999), 999);
+    unittest::ExpectEqual(size_t, doc.GetRowCount(), numRows);
+
+    for (size_t i = 0; i < numRows; ++i)
+    {
+      if (i == 17) continue;
+      unittest::ExpectEqual(size_t, doc.GetRowIdx("r" + std::to_string(i)), i);
+    }
+
+    // remove rows from the tail, remaining rows keep their indexes
+    doc.RemoveRow("r999");
+    doc.RemoveRow(size_t(998));
+    ExpectException(doc.GetRowIdx(r999), std::out_of_range);
+    ExpectException(doc.GetRowIdx("r998"), std::out_of_range);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r997"), 997);
+    unittest::ExpectEqual(size_t, doc.GetRowCount(), numRows - 2);
+    doc.InsertRow<int, int>(998, std::tuple<int, int>{ 998, 1996 }, "r998");
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r998"), 998);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("r997"), 997);
+
+    doc.RemoveColumn("A");
+    unittest::ExpectEqual(size_t, doc.GetColumnIdx("Bee"), 0);
+    ExpectException(doc.GetColumnIdx("A"), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
@@ -0,0 +1,71 @@
+// test101.cpp - column / row accessor with pre-resolved index
+
+#include <rapidcsv/rapidcsv.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+    "3,5,25,625\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    auto colB = doc.GetColumnAccessor<int>("B");
+    unittest::ExpectEqual(size_t, colB.GetColumnIdx(), 1);
+    unittest::ExpectEqual(size_t, colB.size(), 3);
+    unittest::ExpectEqual(int, colB[0], 9);
+    unittest::ExpectEqual(int, colB[2], 25);
+    unittest::ExpectEqual(int, colB.at(1), 16);
+    ExpectException(colB.at(3), std::out_of_range);
+
+    auto row2 = doc.GetRowAccessor<std::string>("2");
+    unittest::ExpectEqual(size_t, row2.GetRowIdx(), 1);
+    unittest::ExpectEqual(size_t, row2.size(), 3);
+    unittest::ExpectEqual(std::string, row2[2], "256");
+
+    auto colCnan = doc.GetColumnAccessor<converter::ConvertFromStr_gNaN<double>>(2);
+    unittest::ExpectEqual(double, std::get<double>(colCnan[0]), 81.0);
+
+    ExpectException(doc.GetColumnAccessor<int>("D"), std::out_of_range);
+    ExpectException(doc.GetColumnAccessor<int>(3), std::out_of_range);
+    ExpectException(doc.GetRowAccessor<int>(3), std::out_of_range);
+
+    // updating cell values keeps the accessor valid
+    doc.SetCell<int>("B", "3", 36);
+    unittest::ExpectTrue(colB.IsValid());
+    unittest::ExpectEqual(int, colB.at(2), 36);
+
+    // structural change invalidates the accessor
+    doc.RemoveColumn("A");
+    unittest::ExpectTrue(!colB.IsValid());
+    unittest::ExpectTrue(!row2.IsValid());
+    ExpectException(colB.at(0), std::out_of_range);
+    ExpectException(row2.at(0), std::out_of_range);
+
+    auto colBnew = doc.GetColumnAccessor<int>("B");
+    unittest::ExpectEqual(int, colBnew.at(0), 9);
+
+    doc.InsertRow<int, int>(0, std::tuple<int, int>{ 1, 1 }, "0");
+    unittest::ExpectTrue(!colBnew.IsValid());
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
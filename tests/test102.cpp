@@ -0,0 +1,94 @@
+// test102.cpp - columnar document, same results as row-major Document
+
+#include <rapidcsv/columnar.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+    "3,5,25,625\n"
+  ;
+
+  std::string csvref =
+    "-,A,Z,C\n"
+    "0,0,x,0\n"
+    "1,3,y,81\n"
+    "3,5,z,1000\n"
+    "4,6,,1296\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    const rapidcsv::LabelParams labelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT);
+    rapidcsv::Document doc(path, labelParams);
+    rapidcsv::ColumnarDocument cdoc(path, labelParams);
+
+    unittest::ExpectEqual(size_t, cdoc.GetColumnCount(), doc.GetColumnCount());
+    unittest::ExpectEqual(size_t, cdoc.GetRowCount(), doc.GetRowCount());
+    unittest::ExpectTrue(cdoc.GetColumn<int>("B") == doc.GetColumn<int>("B"));
+    unittest::ExpectTrue(cdoc.GetColumn<double>(2) == doc.GetColumn<double>(2));
+    unittest::ExpectTrue(cdoc.GetRow_VecStr("2") == doc.GetRow_VecStr("2"));
+    unittest::ExpectTrue((cdoc.GetRow<int, int, int>(2) == doc.GetRow<int, int, int>(2)));
+    unittest::ExpectEqual(int, cdoc.GetCell<int>("C", "3"), 625);
+    unittest::ExpectEqual(std::string, cdoc.GetColumn_VecStr("A").at(1), "4");
+    unittest::ExpectTrue(cdoc.GetColumnNames() == doc.GetColumnNames());
+    unittest::ExpectTrue(cdoc.GetRowNames() == doc.GetRowNames());
+
+    ExpectException(cdoc.GetColumn<int>("D"), std::out_of_range);
+    ExpectException(cdoc.GetRow_VecStr(3), std::out_of_range);
+    ExpectException(cdoc.GetCell<int>("A", "4"), std::out_of_range);
+
+    // same edits on both layouts, gives same output
+    cdoc.RemoveColumn("B");
+    cdoc.InsertColumn<std::string>(1, { "y", "", "z" }, "Z");
+    cdoc.RemoveRow("2");
+    cdoc.InsertRow<int, std::string, int>(0, std::tuple<int, std::string, int>{ 0, "x", 0 }, "0");
+    cdoc.InsertRow_VecStr(3, { "6", "", "1296" }, "4");
+    cdoc.SetCell<int>("C", "3", 1000);
+    ExpectException(cdoc.InsertRow_VecStr(0, { "7", "", "7" }, "1"), std::out_of_range);
+    ExpectException(cdoc.InsertColumn<int>(1, { }, ""), std::out_of_range);
+
+    unittest::ExpectEqual(size_t, cdoc.GetRowIdx("4"), 3);
+    unittest::ExpectEqual(size_t, cdoc.GetColumnIdx("C"), 2);
+    unittest::ExpectEqual(std::string, cdoc.GetCell<std::string>("Z", "1"), "y");
+
+    cdoc.Save(path);
+    std::string csvread = unittest::ReadFile(path);
+    unittest::ExpectEqual(std::string, csvref, csvread);
+
+    // conversion from/to row-major Document
+    rapidcsv::Document doc2(path, labelParams);
+    rapidcsv::ColumnarDocument cdoc2(std::move(doc2));
+    unittest::ExpectEqual(size_t, cdoc2.GetRowCount(), 4);
+    unittest::ExpectEqual(int, cdoc2.GetCell<int>("C", "4"), 1296);
+    rapidcsv::Document doc3 = cdoc2.ToDocument();
+    unittest::ExpectEqual(int, doc3.GetCell<int>("A", "3"), 5);
+    unittest::ExpectEqual(size_t, doc3.GetRowIdx("4"), 3);
+
+    // without labels
+    rapidcsv::ColumnarDocument cdoc4("", rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_MISSING, rapidcsv::FlgRowName::RN_MISSING));
+    cdoc4.SetColumn<int>(1, { 1, 2, 3 });
+    cdoc4.SetRow<std::string, int>(3, std::tuple<std::string, int>{ "d", 4 });
+    unittest::ExpectEqual(size_t, cdoc4.GetRowCount(), 4);
+    unittest::ExpectEqual(size_t, cdoc4.GetColumnCount(), 2);
+    unittest::ExpectEqual(std::string, cdoc4.GetCell<std::string>(0, 0), "");
+    unittest::ExpectEqual(int, cdoc4.GetCell<int>(1, 3), 4);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
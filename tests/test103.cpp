@@ -0,0 +1,97 @@
+// test103.cpp - columnar document, dictionary-encoded columns
+
+#include <rapidcsv/columnar.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "Date,Ticker,Exchange,Close\n"
+    "2024-01-02,MSFT,NASDAQ,370.87\n"
+    "2024-01-02,IBM,NYSE,163.55\n"
+    "2024-01-02,AAPL,NASDAQ,185.64\n"
+    "2024-01-03,MSFT,NASDAQ,370.60\n"
+    "2024-01-03,IBM,NYSE,162.58\n"
+    "2024-01-03,AAPL,NASDAQ,184.25\n"
+  ;
+
+  std::string csvref =
+    "Date,Ticker,Exchange,Close\n"
+    "2024-01-02,MSFT,NASDAQ,370.87\n"
+    "2024-01-02,IBM,NYSE,163.55\n"
+    "2024-01-02,AAPL,NASDAQ,185.64\n"
+    "2024-01-03,MSFT,NASDAQ,370.60\n"
+    "2024-01-03,ORCL,NYSE,106.45\n"
+    "2024-01-04,GOOG,NASDAQ,138.04\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::ColumnarDocument cdoc(path, rapidcsv::LabelParams(), rapidcsv::SeparatorParams(), rapidcsv::LineReaderParams(),
+                                    { "Ticker", "Exchange" });
+
+    unittest::ExpectTrue(cdoc.IsEncodedColumn("Ticker"));
+    unittest::ExpectTrue(cdoc.IsEncodedColumn(2));
+    unittest::ExpectTrue(!cdoc.IsEncodedColumn("Close"));
+
+    const std::vector<std::string>& dict = cdoc.GetColumnDictionary("Ticker");
+    const std::vector<uint32_t>& codes = cdoc.GetColumnCodes("Ticker");
+    unittest::ExpectEqual(size_t, dict.size(), 3);
+    unittest::ExpectEqual(size_t, codes.size(), 6);
+    unittest::ExpectTrue(codes.at(0) == codes.at(3));
+    unittest::ExpectTrue(codes.at(0) != codes.at(1));
+    unittest::ExpectEqual(std::string, dict.at(codes.at(4)), "IBM");
+    unittest::ExpectEqual(uint32_t, cdoc.FindCode("Ticker", "AAPL"), codes.at(2));
+    unittest::ExpectEqual(uint32_t, cdoc.FindCode("Ticker", "ORCL"), rapidcsv::ColumnarDocument::s_NoCode);
+    unittest::ExpectEqual(size_t, cdoc.GetColumnDictionary("Exchange").size(), 2);
+
+    // ranks order codes same as strings
+    const std::vector<uint32_t> ranks = cdoc.GetColumnCodeRanks("Ticker");
+    unittest::ExpectEqual(uint32_t, ranks.at(cdoc.FindCode("Ticker", "AAPL")), 0);
+    unittest::ExpectEqual(uint32_t, ranks.at(cdoc.FindCode("Ticker", "IBM")), 1);
+    unittest::ExpectEqual(uint32_t, ranks.at(cdoc.FindCode("Ticker", "MSFT")), 2);
+
+    // Get/Set on encoded column
+    const std::vector<std::string> tickers = cdoc.GetColumn<std::string>("Ticker");
+    unittest::ExpectEqual(std::string, tickers.at(5), "AAPL");
+    unittest::ExpectEqual(std::string, cdoc.GetCell<std::string>("Exchange", 1), "NYSE");
+    unittest::ExpectTrue((cdoc.GetRow<std::string, std::string, std::string, double>(4) ==
+                          std::tuple<std::string, std::string, std::string, double>{ "2024-01-03", "IBM", "NYSE", 162.58 }));
+
+    cdoc.SetCell<std::string>("Ticker", 4, "ORCL");
+    cdoc.SetCell<double>("Close", 4, 106.45);
+    unittest::ExpectEqual(std::string, cdoc.GetCell<std::string>("Ticker", 4), "ORCL");
+    unittest::ExpectEqual(size_t, cdoc.GetColumnDictionary("Ticker").size(), 4);
+    cdoc.RemoveRow(5);
+    cdoc.InsertRow_VecStr(5, { "2024-01-04", "GOOG", "NASDAQ", "138.04" });
+    unittest::ExpectEqual(size_t, cdoc.GetColumnCodes("Ticker").size(), 6);
+    unittest::ExpectEqual(std::string, cdoc.GetRow_VecStr(5).at(1), "GOOG");
+
+    ExpectException(cdoc.GetColumn_VecStr("Ticker"), std::out_of_range);
+    ExpectException(cdoc.GetColumnCodes("Close"), std::out_of_range);
+
+    cdoc.Save(path);
+    std::string csvread = unittest::ReadFile(path);
+    unittest::ExpectEqual(std::string, csvref, csvread);
+
+    cdoc.DecodeColumn("Ticker");
+    unittest::ExpectTrue(!cdoc.IsEncodedColumn("Ticker"));
+    unittest::ExpectEqual(std::string, cdoc.GetColumn_VecStr("Ticker").at(4), "ORCL");
+    cdoc.EncodeColumn("Date");
+    unittest::ExpectEqual(size_t, cdoc.GetColumnDictionary("Date").size(), 3);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,97 @@
+// test104.cpp - numeric fast path gives same results as converter
+
+#include <cmath>
+#include <rapidcsv/rapidcsv.h>
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+#if USE_FLOATINGPOINT_FROM_CHARS_1  ==  e_ENABLE_FEATURE
+template<typename T>
+using ConvertFromStr_gNaN = converter::ConvertFromStr<T, converter::S2T_Format_std_CtoT<T, converter::FailureS2Tprocess::VARIANT_NAN>>;
+#else
+template<typename T>
+using ConvertFromStr_gNaN = converter::ConvertFromStr<T, converter::S2T_Format_std_StoT<T, converter::FailureS2Tprocess::VARIANT_NAN>>;
+#endif
+
+template<typename T_C>
+bool ColumnMatchesConverter(const rapidcsv::Document& pDoc, const size_t pColumnIdx)
+{
+  const std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> column = pDoc.GetColumn<T_C>(pColumnIdx);
+  const std::vector<std::string> columnStr = pDoc.GetColumn<std::string>(pColumnIdx);
+  for (size_t rowIdx = 0; rowIdx < column.size(); ++rowIdx)
+  {
+    if (!(column.at(rowIdx) == converter::t_S2Tconv_c<T_C>::ToVal(columnStr.at(rowIdx))))
+    {
+      return false;
+    }
+  }
+  return column.size() == columnStr.size();
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,0.5,-7\n"
+    "2,-2147483648,1e3,18446744073709551615\n"
+    "3,2147483647,-2.25,0\n"
+    "4,12x,abc,+5\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    unittest::ExpectEqual(int, doc.GetCell<int>("A", "1"), 3);
+    unittest::ExpectEqual(int, doc.GetCell<int>("A", "2"), -2147483648);
+    unittest::ExpectEqual(int, doc.GetCell<int>("A", "3"), 2147483647);
+    unittest::ExpectEqual(double, doc.GetCell<double>("B", "1"), 0.5);
+    unittest::ExpectEqual(double, doc.GetCell<double>("B", "2"), 1000.0);
+    unittest::ExpectEqual(unsigned long long, doc.GetCell<unsigned long long>("C", "2"), 18446744073709551615ULL);
+    unittest::ExpectEqual(long long, doc.GetCell<long long>("C", "1"), -7);
+
+    // cells not fully parsed by fast path, fall back to converter
+    ExpectException(doc.GetCell<double>("B", "4"), std::invalid_argument);
+    unittest::ExpectTrue((doc.GetCell<ConvertFromStr_gNaN<double>>("B", "4") ==
+                          ConvertFromStr_gNaN<double>::ToVal("abc")));
+    unittest::ExpectTrue((doc.GetCell<ConvertFromStr_gNaN<int>>("A", "4") ==
+                          ConvertFromStr_gNaN<int>::ToVal("12x")));
+    unittest::ExpectEqual(long long, doc.GetCell<long long>("C", "4"), converter::ConvertFromStr<long long>::ToVal("+5"));
+
+    unittest::ExpectTrue(ColumnMatchesConverter<ConvertFromStr_gNaN<int>>(doc, 0));
+    unittest::ExpectTrue(ColumnMatchesConverter<ConvertFromStr_gNaN<long long>>(doc, 0));
+    unittest::ExpectTrue(ColumnMatchesConverter<ConvertFromStr_gNaN<double>>(doc, 1));
+    unittest::ExpectTrue(ColumnMatchesConverter<ConvertFromStr_gNaN<float>>(doc, 1));
+    unittest::ExpectTrue(ColumnMatchesConverter<ConvertFromStr_gNaN<long long>>(doc, 2));
+
+    // row conversion retains column order
+    unittest::ExpectTrue((doc.GetRow<int, double, long long>("3") ==
+                          std::tuple<int, double, long long>{ 2147483647, -2.25, 0 }));
+    const auto row4 = doc.GetRow<ConvertFromStr_gNaN<int>, ConvertFromStr_gNaN<double>, std::string>("4");
+    unittest::ExpectTrue(std::get<0>(row4) == ConvertFromStr_gNaN<int>::ToVal("12x"));
+    unittest::ExpectTrue(std::get<1>(row4) == ConvertFromStr_gNaN<double>::ToVal("abc"));
+    unittest::ExpectEqual(std::string, std::get<2>(row4), "+5");
+
+    // sort-key conversion in views uses same path
+    rapidcsv::SortParams<double, rapidcsv::e_SortOrder::DESCEND> spB(1);
+    rapidcsv::Document doc3(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+    doc3.RemoveRow("4");
+    rapidcsv::SortDocument<decltype(spB)> view(doc3, spB);
+    unittest::ExpectEqual(double, view.GetViewCell<double>(1, 0), 1000.0);
+    unittest::ExpectEqual(double, view.GetViewCell<double>(1, 2), -2.25);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
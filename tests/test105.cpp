@@ -0,0 +1,89 @@
+// test105.cpp - ISO-8601 date/timestamp parsing to compact day/second counts
+
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+namespace rdb = std::chrono;
+
+bool isYear2016(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  const int32_t days = rapidcsv::ConvertFromStr_ISODate::ToVal(dataRow.at(0));
+  return ( days >= rapidcsv::DaysFromCivil(2016, 1, 1) ) && ( days < rapidcsv::DaysFromCivil(2017, 1, 1) );
+}
+
+int main()
+{
+  int rv = 0;
+
+  try
+  {
+    int32_t days = -1;
+    unittest::ExpectTrue(rapidcsv::ParseISODate("1970-01-01", days));
+    unittest::ExpectEqual(int32_t, days, 0);
+    unittest::ExpectTrue(rapidcsv::ParseISODate("2000-02-29", days));
+    unittest::ExpectEqual(int32_t, days, rdb::sys_days{ rdb::year{2000}/2/29 }.time_since_epoch().count());
+    unittest::ExpectTrue(rapidcsv::ParseISODate("1969-12-31", days));
+    unittest::ExpectEqual(int32_t, days, -1);
+    unittest::ExpectTrue(rapidcsv::ToYearMonthDay(rapidcsv::DaysFromCivil(1986, 3, 13)) == rdb::year{1986}/3/13);
+
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("1900-02-29", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("2023-04-31", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("2023-13-01", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("2023-00-10", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("2023-1-10", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("2023-01-1x", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("2023/01/10", days));
+    unittest::ExpectTrue(!rapidcsv::ParseISODate("", days));
+    unittest::ExpectEqual(int32_t, days, -1);
+
+    int64_t seconds = 0;
+    unittest::ExpectTrue(rapidcsv::ParseISOTimestamp("1970-01-02T00:00:01Z", seconds));
+    unittest::ExpectEqual(int64_t, seconds, 86401);
+    unittest::ExpectTrue(rapidcsv::ParseISOTimestamp("1970-01-01 23:59:59", seconds));
+    unittest::ExpectEqual(int64_t, seconds, 86399);
+    unittest::ExpectTrue(rapidcsv::ParseISOTimestamp("1970-01-03", seconds));
+    unittest::ExpectEqual(int64_t, seconds, 172800);
+    unittest::ExpectTrue(!rapidcsv::ParseISOTimestamp("1970-01-01T24:00:00", seconds));
+    unittest::ExpectTrue(!rapidcsv::ParseISOTimestamp("1970-01-01T10:00", seconds));
+    ExpectException(rapidcsv::ConvertFromStr_ISOTimestamp::ToVal("1970-01-01x10:00:00"), std::invalid_argument);
+
+    rapidcsv::Document doc("../../tests/msft.csv", rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    // whole column as day counts, same dates as year_month_day conversion
+    const std::vector<int32_t> dayColumn = doc.GetColumn<rapidcsv::ConvertFromStr_ISODate>("Date");
+    const std::vector<rdb::year_month_day> ymdColumn = doc.GetColumn<rdb::year_month_day>("Date");
+    unittest::ExpectEqual(size_t, dayColumn.size(), 7804);
+    bool sameDates = (dayColumn.size() == ymdColumn.size());
+    for (size_t rowIdx = 0; sameDates && rowIdx < dayColumn.size(); ++rowIdx)
+    {
+      sameDates = (rapidcsv::ToYearMonthDay(dayColumn.at(rowIdx)) == ymdColumn.at(rowIdx));
+    }
+    unittest::ExpectTrue(sameDates);
+    unittest::ExpectEqual(int32_t, doc.GetCell<rapidcsv::ConvertFromStr_ISODate>(0, 0), rapidcsv::DaysFromCivil(2017, 2, 24));
+
+    // sort on day counts, same order as year_month_day
+    const rapidcsv::SortParams<rapidcsv::ConvertFromStr_ISODate> spA(0);
+    rapidcsv::SortDocument<decltype(spA)> viewdoc1(doc, spA);
+    const rapidcsv::SortParams<rdb::year_month_day> spYmd(0);
+    rapidcsv::SortDocument<decltype(spYmd)> viewdoc2(doc, spYmd);
+    unittest::ExpectEqual(size_t, viewdoc1.GetViewRowCount(), 7804);
+    unittest::ExpectTrue(viewdoc1.GetViewColumn<std::string>(0) == viewdoc2.GetViewColumn<std::string>(0));
+    unittest::ExpectEqual(double, viewdoc1.GetViewCell<double>(1, 0), 25.499999);
+
+    rapidcsv::SortKeyFactory<decltype(spA)>::t_sortKey riDate{ rapidcsv::DaysFromCivil(1986, 3, 19) };
+    unittest::ExpectEqual(double, viewdoc1.GetCell_IndexKey<double>("Open", riDate), 28.75);
+
+    // date-range filter on day counts
+    rapidcsv::FilterDocument<isYear2016> viewdoc3(doc);
+    unittest::ExpectEqual(size_t, viewdoc3.GetViewRowCount(), 252);
+
+    ExpectException(rapidcsv::ConvertFromStr_ISODate::ToVal("2016-02-30"), std::invalid_argument);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  return rv;
+}
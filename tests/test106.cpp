@@ -0,0 +1,92 @@
+// test106.cpp - locale-free to_chars formatting of cells
+
+#include <cmath>
+#include <rapidcsv/columnar.h>
+#include "unittest.h"
+
+namespace rdb = std::chrono;
+
+template<typename T>
+using convertT2S_toChars = rapidcsv::ConvertFromVal_ToChars<T>;
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+    "3,5,25,625\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    // same as std::to_string for integers
+    unittest::ExpectEqual(std::string, convertT2S_toChars<int>::ToStr(-2147483647 - 1), std::to_string(-2147483647 - 1));
+    unittest::ExpectEqual(std::string, convertT2S_toChars<unsigned long long>::ToStr(18446744073709551615ULL), "18446744073709551615");
+    unittest::ExpectEqual(std::string, convertT2S_toChars<short>::ToStr(-32768), "-32768");
+    unittest::ExpectEqual(std::string, convertT2S_toChars<rdb::year_month_day>::ToStr(rdb::year{2024}/1/5), "2024-01-05");
+
+    // writes into existing storage
+    std::string cell(64, 'x');
+    const size_t capacity = cell.capacity();
+    convertT2S_toChars<long>::WriteStr(-12345L, cell);
+    unittest::ExpectEqual(std::string, cell, "-12345");
+    unittest::ExpectEqual(size_t, cell.capacity(), capacity);
+
+#if USE_FLOATINGPOINT_FROM_CHARS_1  ==  e_ENABLE_FEATURE
+    // shortest round-trip representation
+    unittest::ExpectEqual(std::string, convertT2S_toChars<double>::ToStr(0.1), "0.1");
+    unittest::ExpectEqual(std::string, convertT2S_toChars<double>::ToStr(100.0), "100");
+    unittest::ExpectEqual(std::string, convertT2S_toChars<float>::ToStr(0.3f), "0.3");
+#endif
+    const std::vector<double> values = { 0.1, 1.0/3.0, -2.5e-300, 1e21, 123456.789 };
+    bool roundTrip = true;
+    for (const double val : values)
+    {
+      roundTrip = roundTrip && (converter::ConvertFromStr<double>::ToVal(convertT2S_toChars<double>::ToStr(val)) == val);
+    }
+    unittest::ExpectTrue(roundTrip);
+
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    // default integer and date formatting unchanged
+    doc.SetColumn<long long>("A", { -9000000000LL, 0, 7 });
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("A", "1"), "-9000000000");
+    doc.SetCell<rdb::year_month_day>("B", "2", rdb::year{1999}/12/31);
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("B", "2"), "1999-12-31");
+
+    // opt-in shortest round-trip formatting
+    doc.SetColumn<convertT2S_toChars<double>>("C", values);
+    const std::vector<double> readBack = doc.GetColumn<double>("C");
+    unittest::ExpectTrue(std::equal(readBack.begin(), readBack.end(), values.begin()));
+
+    doc.SetRow<int, convertT2S_toChars<double>, rdb::year_month_day>("3", { 12, 0.5, rdb::year{2000}/2/29 });
+    unittest::ExpectTrue(doc.GetRow_VecStr("3") == std::vector<std::string>({ "12", "0.5", "2000-02-29" }));
+    doc.InsertRow<int, int, int>(3, { 1, 2, 3 }, "4");
+    unittest::ExpectTrue(doc.GetRow_VecStr("4") == std::vector<std::string>({ "1", "2", "3" }));
+
+    // columnar document, plain and dictionary-encoded columns
+    rapidcsv::ColumnarDocument cdoc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT),
+                                    rapidcsv::SeparatorParams(), rapidcsv::LineReaderParams(), { "B" });
+    cdoc.SetColumn<int>("A", { 10, 20, 30 });
+    cdoc.SetColumn<int>("B", { 1, 1, 2 });
+    cdoc.SetCell<convertT2S_toChars<rdb::year_month_day>>("C", "2", rdb::year{2023}/6/1);
+    unittest::ExpectEqual(std::string, cdoc.GetCell<std::string>("A", "3"), "30");
+    unittest::ExpectEqual(uint32_t, cdoc.GetColumnCodes("B").at(1), cdoc.FindCode("B", "1"));
+    unittest::ExpectEqual(std::string, cdoc.GetCell<std::string>("C", "2"), "2023-06-01");
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,60 @@
+// test107.cpp - get multiple columns in a single pass
+
+#include <rapidcsv/rapidcsv.h>
+#include "unittest.h"
+
+namespace rdb = std::chrono;
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+    "3,5,25\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc("../../tests/msft.csv", rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    const auto [dates, open, close, volume] = doc.GetColumns<rdb::year_month_day, double, double, unsigned long>("Date", "Open", 4, "Volume");
+    unittest::ExpectEqual(size_t, open.size(), 7804);
+    unittest::ExpectTrue(dates == doc.GetColumn<rdb::year_month_day>("Date"));
+    unittest::ExpectTrue(open == doc.GetColumn<double>("Open"));
+    unittest::ExpectTrue(close == doc.GetColumn<double>("Close"));
+    unittest::ExpectTrue(volume == doc.GetColumn<unsigned long>("Volume"));
+
+    // into caller-provided spans
+    std::vector<double> high(doc.GetRowCount());
+    std::vector<std::string> lowStr(doc.GetRowCount());
+    doc.GetColumns<double, std::string>(std::tuple{ std::span<double>(high), std::span<std::string>(lowStr) }, "High", "Low");
+    unittest::ExpectTrue(high == doc.GetColumn<double>("High"));
+    unittest::ExpectTrue(lowStr == doc.GetColumn<std::string>("Low"));
+
+    std::vector<double> shortBuffer(10);
+    ExpectException((doc.GetColumns<double>(std::tuple{ std::span<double>(shortBuffer) }, "High")), std::out_of_range);
+    ExpectException((doc.GetColumns<double, double>("Open", "NoColumn")), std::out_of_range);
+
+    // row with missing cell
+    rapidcsv::Document doc2(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+    const auto [colA, colB] = doc2.GetColumns<int, int>("A", "B");
+    unittest::ExpectTrue(colA == std::vector<int>({ 3, 4, 5 }));
+    unittest::ExpectTrue(colB == std::vector<int>({ 9, 16, 25 }));
+    ExpectException((doc2.GetColumns<int, int>("A", "C")), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,88 @@
+// test108.cpp - get column/row into caller-owned buffers, string_view rows
+
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+bool isOddRow(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 1;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+    "3,5,25,625\n"
+    "4,6,36,1296\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    // reused vector
+    std::vector<int> column;
+    column.reserve(64);
+    const int* const data = column.data();
+    doc.GetColumn<int>("B", column);
+    unittest::ExpectTrue(column == std::vector<int>({ 9, 16, 25, 36 }));
+    doc.GetColumn<int>("C", column);
+    unittest::ExpectTrue(column == std::vector<int>({ 81, 256, 625, 1296 }));
+    unittest::ExpectTrue(column.data() == data);
+
+    // span
+    std::array<long, 4> buffer{};
+    doc.GetColumn<long>("A", std::span<long>(buffer));
+    unittest::ExpectEqual(long, buffer.at(3), 6);
+    std::array<long, 3> shortBuffer{};
+    ExpectException(doc.GetColumn<long>("A", std::span<long>(shortBuffer)), std::out_of_range);
+    ExpectException(doc.GetColumn<int>("D", column), std::out_of_range);
+
+    // string_view row, borrowed from document
+    const std::vector<std::string_view> rowView = doc.GetRow_VecStrView("2");
+    unittest::ExpectEqual(size_t, rowView.size(), 3);
+    unittest::ExpectTrue(rowView.at(1) == "16");
+    unittest::ExpectTrue(rowView.at(2).data() == doc.GetRow_VecStrView(1).at(2).data());
+    std::vector<std::string_view> rowBuffer;
+    doc.GetRow_VecStrView(3, rowBuffer);
+    unittest::ExpectTrue(rowBuffer.at(2) == "1296");
+
+    // view
+    rapidcsv::FilterDocument<isOddRow> viewdoc(doc);
+    unittest::ExpectEqual(size_t, viewdoc.GetViewRowCount(), 2);
+    std::vector<double> viewColumn(10, 0.0);
+    viewdoc.GetViewColumn<double>("C", viewColumn);
+    unittest::ExpectTrue(viewColumn == std::vector<double>({ 81, 625 }));
+    std::array<std::string, 2> viewStr;
+    viewdoc.GetViewColumn<std::string>(0, std::span<std::string>(viewStr));
+    unittest::ExpectEqual(std::string, viewStr.at(1), "5");
+    ExpectException(viewdoc.GetViewColumn<double>("C", std::span<double>(viewColumn.data(), 1)), std::out_of_range);
+
+    const std::vector<std::string_view> viewRow = viewdoc.GetViewRow_VecStrView(1);
+    unittest::ExpectTrue(viewRow.at(0) == "5");
+    viewdoc.GetViewRow_VecStrView("1", rowBuffer);
+    unittest::ExpectTrue(rowBuffer.at(2) == "81");
+    ExpectException(viewdoc.GetViewRow_VecStrView("2"), std::out_of_range);
+
+    // view left stale by removed rows
+    doc.RemoveRow(3);
+    doc.RemoveRow(2);
+    ExpectException(viewdoc.GetViewColumn<double>("C"), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,85 @@
+// test109.cpp - move rows/columns into document, emplace row
+
+#include <rapidcsv/rapidcsv.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+  ;
+
+  std::string csvref =
+    "-,A,B,C\n"
+    "0,x,y,z\n"
+    "1,3,long_cell_value_which_is_not_in_small_string_buffer,81\n"
+    "2,p,q,r\n"
+    "5,,,\n"
+    "3,5,25,625\n"
+    "4,6,36,\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    // cell buffer is moved, not copied
+    std::vector<std::string> column;
+    column.emplace_back("long_cell_value_which_is_not_in_small_string_buffer");
+    column.emplace_back("16");
+    const char* const longCellData = column.front().data();
+    doc.SetColumn<std::string>("B", std::move(column));
+    unittest::ExpectTrue(doc.GetRow_VecStrView("1").at(1).data() == longCellData);
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("B", "1"), "long_cell_value_which_is_not_in_small_string_buffer");
+
+    // rvalue non-string column is converted
+    doc.SetColumn<int>("C", std::vector<int>({ 81, 256 }));
+    unittest::ExpectEqual(int, doc.GetCell<int>("C", "2"), 256);
+
+    std::vector<std::string> row = { "p", "q", "r" };
+    doc.SetRow_VecStr("2", std::move(row));
+    unittest::ExpectTrue(doc.GetRow_VecStr("2") == std::vector<std::string>({ "p", "q", "r" }));
+
+    // shorter row sets only leading cells
+    std::vector<std::string> row1 = doc.GetRow_VecStr("1");
+    doc.SetRow_VecStr("1", std::vector<std::string>({ "7" }));
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("A", "1"), "7");
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("C", "1"), "81");
+    doc.SetRow_VecStr("1", std::move(row1));
+
+    std::vector<std::string> row3 = { "5", "25", "625" };
+    doc.InsertRow_VecStr(2, std::move(row3), "3");
+    doc.InsertRow_VecStr(0, { "x", "y", "z" }, "0");
+    ExpectException(doc.InsertRow_VecStr(0, { "x", "y", "z" }, "0"), std::out_of_range);
+
+    // emplace
+    std::string cellA("6");
+    rapidcsv::Document::t_dataRow& row4 = doc.EmplaceRow(4, "4", std::move(cellA), std::string_view("36"), "");
+    unittest::ExpectEqual(size_t, row4.size(), 3);
+    rapidcsv::Document::t_dataRow& row5 = doc.EmplaceRow(3, "5");
+    unittest::ExpectEqual(size_t, row5.size(), 3);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("4"), 5);
+    unittest::ExpectEqual(size_t, doc.GetRowIdx("3"), 4);
+    ExpectException(doc.EmplaceRow(0, "", "a"), std::out_of_range);
+
+    doc.Save(path);
+    std::string csvread = unittest::ReadFile(path);
+    unittest::ExpectEqual(std::string, csvref, csvread);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
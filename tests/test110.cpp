@@ -0,0 +1,118 @@
+// test110.cpp - views allocating their row maps from a std::pmr::memory_resource, released in one shot
+
+#include <memory_resource>
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+  explicit CountingResource(std::pmr::memory_resource* pUpstream)
+    : mUpstream(pUpstream)
+  {}
+
+  CountingResource(const CountingResource&) = delete;
+  CountingResource& operator=(const CountingResource&) = delete;
+
+  size_t mAllocations = 0;
+  size_t mDeallocations = 0;
+
+private:
+  void* do_allocate(size_t pBytes, size_t pAlign) override
+  {
+    ++mAllocations;
+    return mUpstream->allocate(pBytes, pAlign);
+  }
+
+  void do_deallocate(void* pPtr, size_t pBytes, size_t pAlign) override
+  {
+    ++mDeallocations;
+    mUpstream->deallocate(pPtr, pBytes, pAlign);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& pOther) const noexcept override
+  {
+    return this == &pOther;
+  }
+
+  std::pmr::memory_resource* mUpstream;
+};
+
+bool isOddRow(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 1;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\n"
+    "1,3,9,81\n"
+    "2,4,16,256\n"
+    "3,5,25,625\n"
+    "4,6,36,1296\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+    unittest::ExpectEqual(int, doc.GetCell<int>("B", "3"), 25);
+
+    // 'upstream' sees the arena's chunks, 'counting' the allocations of the views
+    CountingResource upstream(std::pmr::new_delete_resource());
+    std::pmr::monotonic_buffer_resource arena(&upstream);
+    CountingResource counting(&arena);
+    {
+      rapidcsv::FilterDocument<isOddRow> filterdoc(doc, &counting);
+      unittest::ExpectTrue(counting.mAllocations > 0);
+      unittest::ExpectEqual(size_t, filterdoc.GetViewRowCount(), 2);
+
+      // the reverse row map, built on first lookup by name, is from the view's resource too
+      size_t allocations = counting.mAllocations;
+      unittest::ExpectEqual(size_t, filterdoc.GetViewRowIdx("3"), 1);
+      unittest::ExpectTrue(counting.mAllocations > allocations);
+
+      allocations = counting.mAllocations;
+      rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spA(0);
+      rapidcsv::SortDocument<decltype(spA)> sortdoc(doc, spA, &counting);
+      unittest::ExpectTrue(counting.mAllocations > allocations);
+      unittest::ExpectEqual(int, sortdoc.GetViewCell<int>("A", size_t(0)), 6);
+
+      // view over a view, with its own resource
+      allocations = counting.mAllocations;
+      rapidcsv::FilterDocument<isOddRow> childdoc(sortdoc, &counting);
+      unittest::ExpectTrue(counting.mAllocations > allocations);
+      unittest::ExpectEqual(int, childdoc.GetViewCell<int>("A", size_t(0)), 5);
+
+      // nullptr selects the default resource
+      allocations = counting.mAllocations;
+      rapidcsv::SortDocument<decltype(spA)> sortdocDefault(doc, spA);
+      unittest::ExpectEqual(size_t, counting.mAllocations, allocations);
+      unittest::ExpectEqual(int, sortdocDefault.GetViewCell<int>("C", size_t(3)), 81);
+
+      rapidcsv::FilterTopKSortDocument<isOddRow, decltype(spA)> topkdoc(doc, 1, spA, &counting);
+      unittest::ExpectEqual(size_t, topkdoc.GetViewRowCount(), 1);
+      unittest::ExpectEqual(int, topkdoc.GetViewCell<int>("A", size_t(0)), 5);
+    }
+
+    // the views are destroyed, but the arena keeps its chunks until released in one shot
+    unittest::ExpectTrue(upstream.mAllocations > 0);
+    unittest::ExpectEqual(size_t, upstream.mDeallocations, 0);
+    arena.release();
+    unittest::ExpectEqual(size_t, upstream.mDeallocations, upstream.mAllocations);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
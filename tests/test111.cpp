@@ -0,0 +1,110 @@
+// test111.cpp - lazy document, rows tokenized on access
+
+#include <rapidcsv/lazy.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "-,A,B,C\r\n"
+    "# comment line\r\n"
+    "1,3,9,81\r\n"
+    "\r\n"
+    "2,\"4\",\"line\r\nbreak\",256\r\n"
+    "3,5,\"a,b\",625\r\n"
+    "4,6,36,1296"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    const rapidcsv::LabelParams labelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT);
+    const rapidcsv::SeparatorParams separatorParams(',', false, rapidcsv::sPlatformHasCR, true);
+    const rapidcsv::LineReaderParams lineReaderParams(true, '#', true);
+
+    rapidcsv::Document doc(path, labelParams, separatorParams, lineReaderParams);
+    rapidcsv::LazyDocument lazydoc(path, labelParams, separatorParams, lineReaderParams, 2);
+
+    unittest::ExpectEqual(size_t, lazydoc.GetRowCount(), doc.GetRowCount());
+    unittest::ExpectEqual(size_t, lazydoc.GetColumnCount(), 3);
+    unittest::ExpectEqual(size_t, lazydoc.GetCachedRowCount(), 0);
+    unittest::ExpectTrue(lazydoc.GetColumnNames() == doc.GetColumnNames());
+    unittest::ExpectTrue(lazydoc.GetRowNames() == doc.GetRowNames());
+
+    unittest::ExpectEqual(std::string, lazydoc.GetCell<std::string>("B", "2"), "line\r\nbreak");
+    unittest::ExpectEqual(int, lazydoc.GetCell<int>("A", "2"), 4);
+    unittest::ExpectEqual(std::string, lazydoc.GetCell<std::string>(1, 2), "a,b");
+    unittest::ExpectEqual(size_t, lazydoc.GetCachedRowCount(), 2);
+    unittest::ExpectEqual(long, std::get<1>(lazydoc.GetRow<int, long>("4")), 36);
+    unittest::ExpectEqual(size_t, lazydoc.GetCachedRowCount(), 2);
+
+    // column scan does not fill cache
+    unittest::ExpectTrue(lazydoc.GetColumn<int>("C") == doc.GetColumn<int>("C"));
+    unittest::ExpectEqual(size_t, lazydoc.GetCachedRowCount(), 2);
+    unittest::ExpectTrue(lazydoc.GetColumn<int>("A") == doc.GetColumn<int>("A"));
+    unittest::ExpectTrue(lazydoc.GetColumn<std::string>("B") == doc.GetColumn<std::string>("B"));
+    unittest::ExpectEqual(size_t, lazydoc.GetCachedRowCount(), 2);
+
+    for (size_t rowIdx = 0; rowIdx < doc.GetRowCount(); ++rowIdx)
+    {
+      unittest::ExpectTrue(lazydoc.GetRow_VecStr(rowIdx) == doc.GetRow_VecStr(rowIdx));
+    }
+
+    rapidcsv::Document copydoc = lazydoc.ToDocument();
+    unittest::ExpectTrue(copydoc.GetColumn<std::string>("B") == doc.GetColumn<std::string>("B"));
+    unittest::ExpectEqual(std::string, copydoc.GetRowName(3), "4");
+
+    ExpectException(lazydoc.GetCell<int>("A", "9"), std::out_of_range);
+    ExpectException(lazydoc.GetRow_VecStr(4), std::out_of_range);
+    ExpectException(lazydoc.GetColumn<int>("D"), std::out_of_range);
+
+    // no labels, no quoted linebreaks
+    std::istringstream stream("1,2\n\n3,4\n");
+    rapidcsv::LazyDocument lazydoc2(stream, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_MISSING, rapidcsv::FlgRowName::RN_MISSING));
+    unittest::ExpectEqual(size_t, lazydoc2.GetRowCount(), 3);
+    unittest::ExpectEqual(size_t, lazydoc2.GetColumnCount(), 2);
+    unittest::ExpectTrue(lazydoc2.GetRow_VecStr(1) == std::vector<std::string>({ "" }));
+    unittest::ExpectEqual(int, lazydoc2.GetCell<int>(1, 2), 4);
+
+    // no labels, no data rows
+    std::istringstream emptyStream("");
+    rapidcsv::LazyDocument lazydoc3(emptyStream, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_MISSING, rapidcsv::FlgRowName::RN_MISSING));
+    unittest::ExpectEqual(size_t, lazydoc3.GetRowCount(), 0);
+    unittest::ExpectEqual(size_t, lazydoc3.GetColumnCount(), 0);
+
+    // file larger than one read chunk, rows with quoted linebreaks span the chunk boundaries
+    std::string bigCsv = "A,B\n";
+    while (bigCsv.size() < (3 * rapidcsv::LazyDocument::s_ReadChunkSize))
+    {
+      const std::string idx = std::to_string(bigCsv.size());
+      bigCsv += idx + ",\"" + std::string(1000, 'x') + "\n" + idx + "\"\n";
+    }
+    std::string bigPath = unittest::TempPath();
+    unittest::WriteFile(bigPath, bigCsv);
+    const rapidcsv::SeparatorParams bigSeparatorParams(',', false, false, true);
+    rapidcsv::Document bigdoc(bigPath, rapidcsv::LabelParams(), bigSeparatorParams);
+    rapidcsv::LazyDocument bigLazydoc(bigPath, rapidcsv::LabelParams(), bigSeparatorParams);
+    unittest::ExpectEqual(size_t, bigLazydoc.GetRowCount(), bigdoc.GetRowCount());
+    unittest::ExpectTrue(bigLazydoc.GetColumn<long>("A") == bigdoc.GetColumn<long>("A"));
+    for (size_t rowIdx = 0; rowIdx < bigdoc.GetRowCount(); rowIdx += 97)
+    {
+      unittest::ExpectTrue(bigLazydoc.GetRow_VecStr(rowIdx) == bigdoc.GetRow_VecStr(rowIdx));
+    }
+    unittest::ExpectTrue(bigLazydoc.GetRow_VecStr(bigdoc.GetRowCount() - 1) ==
+                         bigdoc.GetRow_VecStr(bigdoc.GetRowCount() - 1));
+    unittest::DeleteFile(bigPath);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,96 @@
+// test112.cpp - external merge sort of a CSV file
+
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <rapidcsv/extsort.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Key,Name\n";
+  for (int id = 0; id < 500; ++id)
+  {
+    csv += std::to_string(id) + "," + std::to_string((id * 37) % 50) + ",\"n," + std::to_string(id % 7) + "\"\n";
+    if (id == 250)
+    {
+      csv += "# comment line\n";
+    }
+  }
+
+  std::string path = unittest::TempPath();
+  std::string outPath = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    const rapidcsv::LabelParams labelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING);
+    const rapidcsv::LineReaderParams lineReaderParams(true);
+    rapidcsv::Document doc(path, labelParams, rapidcsv::SeparatorParams(), lineReaderParams);
+
+    // expected : stable sort on 'Key' descending, then 'Name' ascending
+    const std::vector<int> ids = doc.GetColumn<int>("Id");
+    const std::vector<int> keys = doc.GetColumn<int>("Key");
+    const std::vector<std::string> names = doc.GetColumn<std::string>("Name");
+    std::vector<size_t> order(ids.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs)
+                     { return (keys[lhs] != keys[rhs]) ? (keys[lhs] > keys[rhs]) : (names[lhs] < names[rhs]); });
+    std::vector<int> expectedIds;
+    for (size_t rowIdx : order)
+    {
+      expectedIds.push_back(ids[rowIdx]);
+    }
+
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spKey(1);
+    rapidcsv::SortParams<std::string> spName(2);
+
+    // many runs
+    rapidcsv::ExternalSort<decltype(spKey), decltype(spName)>
+      extsort(rapidcsv::ExternalSortParams(1024), labelParams, rapidcsv::SeparatorParams(), lineReaderParams, spKey, spName);
+    unittest::ExpectEqual(size_t, extsort.Sort(path, outPath), 500);
+    unittest::ExpectTrue(extsort.GetRunCount() > 10);
+    unittest::ExpectEqual(size_t, extsort.GetMergePassCount(), 1);
+
+    rapidcsv::Document sorted(outPath, labelParams);
+    unittest::ExpectTrue(sorted.GetColumnNames() == doc.GetColumnNames());
+    unittest::ExpectTrue(sorted.GetColumn<int>("Id") == expectedIds);
+    unittest::ExpectEqual(std::string, sorted.GetCell<std::string>("Name", 0), "n,0");
+
+    // many runs, merged in passes of at most 3 runs into intermediate runs, which are removed
+    const std::filesystem::path tempDir = path + ".runs";
+    std::filesystem::create_directory(tempDir);
+    rapidcsv::ExternalSort<decltype(spKey), decltype(spName)>
+      passsort(rapidcsv::ExternalSortParams(1024, tempDir.string(), 3), labelParams, rapidcsv::SeparatorParams(), lineReaderParams, spKey, spName);
+    unittest::ExpectEqual(size_t, passsort.Sort(path, outPath), 500);
+    unittest::ExpectTrue(passsort.GetRunCount() > 27);
+    unittest::ExpectTrue(passsort.GetMergePassCount() > 3);
+    unittest::ExpectTrue(std::filesystem::is_empty(tempDir));
+    std::filesystem::remove(tempDir);
+    rapidcsv::Document sorted3(outPath, labelParams);
+    unittest::ExpectTrue(sorted3.GetColumn<int>("Id") == expectedIds);
+
+    // single run in memory
+    rapidcsv::ExternalSort<decltype(spKey), decltype(spName)>
+      memsort(rapidcsv::ExternalSortParams(), labelParams, rapidcsv::SeparatorParams(), lineReaderParams, spKey, spName);
+    unittest::ExpectEqual(size_t, memsort.Sort(path, outPath), 500);
+    unittest::ExpectEqual(size_t, memsort.GetRunCount(), 1);
+    unittest::ExpectEqual(size_t, memsort.GetMergePassCount(), 0);
+    rapidcsv::Document sorted2(outPath, labelParams);
+    unittest::ExpectTrue(sorted2.GetColumn<int>("Id") == expectedIds);
+
+    ExpectException(extsort.Sort(path + ".missing", outPath), std::ios_base::failure);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+  unittest::DeleteFile(outPath);
+
+  return rv;
+}
@@ -0,0 +1,70 @@
+// test113.cpp - top-K sort views
+
+#include <algorithm>
+#include <numeric>
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+bool isEvenId(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 0;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Volume,Name\n";
+  for (int id = 0; id < 200; ++id)
+  {
+    csv += std::to_string(id) + "," + std::to_string((id * 53) % 40) + ",n" + std::to_string(id % 3) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    const std::vector<int> ids = doc.GetColumn<int>("Id");
+    const std::vector<int> volumes = doc.GetColumn<int>("Volume");
+    std::vector<size_t> order(ids.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return volumes[lhs] > volumes[rhs]; });
+
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spVolume(1);
+    rapidcsv::TopKSortDocument<decltype(spVolume)> topdoc(doc, 10, spVolume);
+    unittest::ExpectEqual(size_t, topdoc.GetViewRowCount(), 10);
+    unittest::ExpectEqual(size_t, topdoc.GetLimit(), 10);
+    for (size_t viewRowIdx = 0; viewRowIdx < 10; ++viewRowIdx)
+    {
+      // equal volumes are ordered by document row index
+      unittest::ExpectEqual(int, topdoc.GetViewCell<int>("Id", viewRowIdx), ids[order[viewRowIdx]]);
+      unittest::ExpectEqual(size_t, topdoc.GetDocumentRowIdx(viewRowIdx), order[viewRowIdx]);
+    }
+    unittest::ExpectEqual(int, topdoc.GetViewCell<int>("Volume", size_t(0)), 39);
+    unittest::ExpectTrue(topdoc.GetViewRow_VecStr(size_t(9)) == doc.GetRow_VecStr(order[9]));
+
+    // filter and two sort columns
+    rapidcsv::SortParams<std::string> spName(2);
+    rapidcsv::SortParams<int> spId(0);
+    rapidcsv::FilterTopKSortDocument<isEvenId, decltype(spName), decltype(spId)> filterdoc(doc, 3, spName, spId);
+    unittest::ExpectTrue(filterdoc.GetViewColumn<int>("Id") == std::vector<int>({ 0, 6, 12 }));
+
+    // limit larger than rows
+    rapidcsv::TopKSortDocument<decltype(spVolume)> alldoc(doc, 1000, spVolume);
+    unittest::ExpectEqual(size_t, alldoc.GetViewRowCount(), 200);
+    rapidcsv::TopKSortDocument<decltype(spVolume)> nonedoc(doc, 0, spVolume);
+    unittest::ExpectEqual(size_t, nonedoc.GetViewRowCount(), 0);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
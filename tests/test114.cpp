@@ -0,0 +1,120 @@
+// test114.cpp - runtime filter expressions
+
+#include <rapidcsv/filterexpr.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Volume,Name\n";
+  for (int id = 0; id < 3000; ++id)
+  {
+    csv += std::to_string(id) + "," + std::to_string((id * 53) % 40) + ",n" + std::to_string(id % 3) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    const std::vector<int> ids = doc.GetColumn<int>("Id");
+    const std::vector<int> volumes = doc.GetColumn<int>("Volume");
+    const std::vector<std::string> names = doc.GetColumn<std::string>("Name");
+
+    using rapidcsv::FilterExpr;
+    const FilterExpr expr = (FilterExpr::Range<int>("Volume", 10, 19) & !FilterExpr::Compare<std::string>(2, rapidcsv::e_CompareOp::EQUAL, "n1"))
+                            | FilterExpr::In<int>("Id", { 2999, 5, 7, 5 });
+
+    std::vector<size_t> expected;
+    for (size_t rowIdx = 0; rowIdx < ids.size(); ++rowIdx)
+    {
+      if (((volumes[rowIdx] >= 10) && (volumes[rowIdx] <= 19) && (names[rowIdx] != "n1")) ||
+          (ids[rowIdx] == 2999) || (ids[rowIdx] == 5) || (ids[rowIdx] == 7))
+      {
+        expected.push_back(rowIdx);
+      }
+    }
+
+    const rapidcsv::FilterPlan plan = expr.Compile(doc);
+    unittest::ExpectTrue(plan.Select() == expected);
+    // a sub-expression used twice has its own buffers in each place, also over several blocks
+    const rapidcsv::FilterPlan twicePlan = (expr & expr).Compile(doc);
+    unittest::ExpectTrue(twicePlan.Select() == expected);
+    unittest::ExpectTrue(twicePlan.Select() == expected);
+    unittest::ExpectTrue(plan.Evaluate(size_t(5)));
+    unittest::ExpectEqual(bool, plan.Evaluate(size_t(4)), false);
+
+    std::vector<uint8_t> mask(5);
+    plan.Evaluate(size_t(3), mask);
+    unittest::ExpectTrue(mask == std::vector<uint8_t>({ 0, 0, 1, 0, 1 }));
+    ExpectException(plan.Evaluate(size_t(2998), mask), std::out_of_range);
+
+    rapidcsv::ExprFilterDocument viewdoc(doc, expr);
+    unittest::ExpectEqual(size_t, viewdoc.GetViewRowCount(), expected.size());
+    unittest::ExpectEqual(size_t, viewdoc.GetDocumentRowIdx(expected.size() - 1), 2999);
+    unittest::ExpectEqual(int, viewdoc.GetViewCell<int>("Id", size_t(0)), ids[expected[0]]);
+
+    // rows gathered by row index, in reverse order and over several blocks
+    std::vector<size_t> reversedRowIdxs(ids.size());
+    for (size_t rowIdx = 0; rowIdx < ids.size(); ++rowIdx)
+    {
+      reversedRowIdxs[ids.size() - 1 - rowIdx] = rowIdx;
+    }
+    const std::vector<size_t> expectedReversed(expected.rbegin(), expected.rend());
+    unittest::ExpectTrue(plan.Select(reversedRowIdxs) == expectedReversed);
+    std::vector<uint8_t> gatherMask(reversedRowIdxs.size());
+    plan.Evaluate(reversedRowIdxs, gatherMask);
+    for (size_t idx = 0; idx < reversedRowIdxs.size(); ++idx)
+    {
+      unittest::ExpectEqual(bool, gatherMask[idx] != 0, plan.Evaluate(reversedRowIdxs[idx]));
+    }
+    const std::vector<size_t> badRowIdxs = { 3, 3000 };
+    ExpectException(plan.Select(badRowIdxs), std::out_of_range);
+    ExpectException(plan.Evaluate(badRowIdxs, mask), std::out_of_range);
+
+    // drill-down over a sort-view, keeping its order
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spId(0);
+    rapidcsv::SortDocument<decltype(spId)> byIdDesc(doc, spId);
+    rapidcsv::ExprFilterDocument drilldoc(byIdDesc, expr);
+    unittest::ExpectEqual(size_t, drilldoc.GetViewRowCount(), expected.size());
+    for (size_t viewRowIdx = 0; viewRowIdx < expectedReversed.size(); ++viewRowIdx)
+    {
+      unittest::ExpectEqual(size_t, drilldoc.GetDocumentRowIdx(viewRowIdx), expectedReversed[viewRowIdx]);
+    }
+
+    const FilterExpr lessExpr = FilterExpr::Compare<int>("Volume", rapidcsv::e_CompareOp::LESS, 1);
+    rapidcsv::ExprFilterDocument lessdoc(doc, lessExpr);
+    unittest::ExpectEqual(size_t, lessdoc.GetViewRowCount(), 75);
+
+    ExpectException(FilterExpr::Compare<int>("Missing", rapidcsv::e_CompareOp::EQUAL, 1).Compile(doc), std::out_of_range);
+    ExpectException(FilterExpr::Compare<int>("Id", static_cast<rapidcsv::e_CompareOp>(99), 1), std::invalid_argument);
+
+    // right operand is converted only on rows the left operand leaves undecided
+    rapidcsv::Document mixedDoc(std::string(), rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    mixedDoc.SetColumnName(0, "Type");
+    mixedDoc.SetColumnName(1, "Val");
+    mixedDoc.AppendRows_VecStr({ { "num", "5" }, { "text", "abc" }, { "num", "7" } });
+    const FilterExpr isNum = FilterExpr::Compare<std::string>("Type", rapidcsv::e_CompareOp::EQUAL, "num");
+    const FilterExpr isText = FilterExpr::Compare<std::string>("Type", rapidcsv::e_CompareOp::EQUAL, "text");
+    const FilterExpr isAbove6 = FilterExpr::Compare<int>("Val", rapidcsv::e_CompareOp::GREATER, 6);
+    const rapidcsv::FilterPlan andPlan = isNum.And(isAbove6).Compile(mixedDoc);
+    unittest::ExpectTrue(andPlan.Select() == std::vector<size_t>({ 2 }));
+    unittest::ExpectEqual(bool, andPlan.Evaluate(size_t(1)), false);
+    const rapidcsv::FilterPlan orPlan = isText.Or(isAbove6).Compile(mixedDoc);
+    unittest::ExpectTrue(orPlan.Select() == std::vector<size_t>({ 1, 2 }));
+    const rapidcsv::FilterPlan notPlan = (!isText).And(isAbove6).Compile(mixedDoc);
+    unittest::ExpectTrue(notPlan.Select() == std::vector<size_t>({ 2 }));
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
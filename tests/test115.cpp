@@ -0,0 +1,85 @@
+// test115.cpp - range queries on FilterSortDocument sort keys
+
+#include <algorithm>
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Name,Volume\n";
+  for (int id = 0; id < 300; ++id)
+  {
+    csv += std::to_string(id) + ",n" + std::to_string(id % 7) + "," + std::to_string((id * 37) % 101) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    // single column, descending
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spVolume(2);
+    rapidcsv::SortDocument<decltype(spVolume)> volumedoc(doc, spVolume);
+    // duplicate volumes collapse to a single view row
+    unittest::ExpectEqual(size_t, volumedoc.GetViewRowCount(), 101);
+    unittest::ExpectEqual(size_t, volumedoc.LowerBound(std::make_tuple(60)), 40);
+    unittest::ExpectEqual(size_t, volumedoc.UpperBound(std::make_tuple(60)), 41);
+    unittest::ExpectEqual(size_t, volumedoc.UpperBound(std::make_tuple(-1)), 101);
+    unittest::ExpectEqual(size_t, volumedoc.LowerBound(std::make_tuple(500)), 0);
+    // last row with the sort-key is indexed, i.e. same as before range queries
+    unittest::ExpectEqual(int, volumedoc.GetRow_IndexKey<int>(std::make_tuple(60)) == std::make_tuple(0), false);
+    unittest::ExpectEqual(int, volumedoc.GetCell_IndexKey<int>("Id", std::make_tuple(0)), 202);
+
+    // two columns, prefix lookup on the leading column
+    rapidcsv::SortParams<std::string> spName(1);
+    rapidcsv::SortParams<int> spId(0);
+    rapidcsv::SortDocument<decltype(spName), decltype(spId)> namedoc(doc, spName, spId);
+    unittest::ExpectEqual(size_t, namedoc.GetViewRowCount(), 300);
+
+    const std::pair<size_t, size_t> rangeN3 = namedoc.EqualRange(std::make_tuple(std::string("n3")));
+    unittest::ExpectEqual(size_t, rangeN3.first, 43 * 3);
+    unittest::ExpectEqual(size_t, rangeN3.second, 43 * 3 + 43);
+    for (size_t viewRowIdx = rangeN3.first; viewRowIdx < rangeN3.second; ++viewRowIdx)
+    {
+      unittest::ExpectEqual(std::string, namedoc.GetViewCell<std::string>("Name", viewRowIdx), "n3");
+    }
+
+    const auto itRange = namedoc.EqualRange_Iter(std::make_tuple(std::string("n3")));
+    unittest::ExpectEqual(size_t, static_cast<size_t>(std::distance(itRange.first, itRange.second)), 43);
+    unittest::ExpectEqual(size_t, itRange.first->second, 3);
+    unittest::ExpectEqual(int, std::get<1>(std::prev(itRange.second)->first), 297);
+
+    // full key
+    const std::pair<size_t, size_t> rangeKey = namedoc.EqualRange(std::make_tuple(std::string("n3"), 11));
+    unittest::ExpectEqual(size_t, rangeKey.first, rangeKey.second);
+    const std::pair<size_t, size_t> rangeKey17 = namedoc.EqualRange({ "n3", 17 });
+    unittest::ExpectEqual(size_t, rangeKey17.second - rangeKey17.first, 1);
+    unittest::ExpectEqual(int, namedoc.GetViewCell<int>("Id", rangeKey17.first), 17);
+
+    // range between keys, i.e. ids of 'n3' in [100, 200)
+    const size_t lower = namedoc.LowerBound(std::make_tuple(std::string("n3"), 100));
+    const size_t upper = namedoc.LowerBound(std::make_tuple(std::string("n3"), 200));
+    unittest::ExpectEqual(int, namedoc.GetViewCell<int>("Id", lower), 101);
+    unittest::ExpectEqual(size_t, upper - lower, 15);
+
+    // missing prefix gives empty range at insertion point
+    const std::pair<size_t, size_t> rangeMissing = namedoc.EqualRange(std::make_tuple(std::string("n35")));
+    unittest::ExpectEqual(size_t, rangeMissing.first, rangeN3.second);
+    unittest::ExpectEqual(size_t, rangeMissing.second, rangeN3.second);
+
+    ExpectException(namedoc.GetRow_IndexKey_VecStr({ "n3", 11 }), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,147 @@
+// test116.cpp - hash index on columns
+
+#include <chrono>
+#include <rapidcsv/hashindex.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "Id,Instrument,Date\n"
+    "0,ABC,2024-01-02\n"
+    "1,XYZ,2024-01-02\n"
+    "2,ABC,2024-01-03\n"
+    "3,DEF,2024-01-03\n"
+    "4,ABC,2024-01-02\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    using namespace std::chrono_literals;
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    rapidcsv::HashIndex<std::string> instrumentIdx(doc, "Instrument");
+    unittest::ExpectEqual(size_t, instrumentIdx.GetKeyCount(), 3);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowCount(), 5);
+    std::span<const size_t> abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 0, 2, 4 }));
+    unittest::ExpectTrue(instrumentIdx.GetRowIdxs({ "QQQ" }).empty());
+    unittest::ExpectEqual(bool, instrumentIdx.Contains({ "DEF" }), true);
+
+    // two key columns, one of them a date
+    rapidcsv::HashIndex<std::string, std::chrono::year_month_day> instrumentDateIdx(doc, "Instrument", 2);
+    unittest::ExpectEqual(size_t, instrumentDateIdx.GetKeyCount(), 4);
+    std::span<const size_t> abcDayRows = instrumentDateIdx.GetRowIdxs({ "ABC", 2024y/1/2 });
+    unittest::ExpectTrue(std::vector<size_t>(abcDayRows.begin(), abcDayRows.end()) == std::vector<size_t>({ 0, 4 }));
+
+    // incremental maintenance
+    doc.InsertRow<int, std::string, std::string>(1, std::make_tuple(5, "ABC", "2024-01-04"));
+    unittest::ExpectEqual(bool, instrumentIdx.IsValid(), false);
+    ExpectException(instrumentIdx.GetRowIdxs({ "ABC" }), std::out_of_range);
+    instrumentIdx.InsertRow(1);
+    unittest::ExpectEqual(bool, instrumentIdx.IsValid(), true);
+    abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 0, 1, 3, 5 }));
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowIdxs({ "XYZ" })[0], 2);
+
+    doc.InsertRow<int, std::string, std::string>(6, std::make_tuple(6, "GHI", "2024-01-04"));
+    instrumentIdx.InsertRow(6);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowIdxs({ "GHI" })[0], 6);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetKeyCount(), 4);
+
+    doc.RemoveRow(size_t(4));
+    instrumentIdx.RemoveRow(4);
+    unittest::ExpectEqual(bool, instrumentIdx.Contains({ "DEF" }), false);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowIdxs({ "GHI" })[0], 5);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowCount(), 6);
+
+    // more than one change since the last update can't be applied
+    doc.RemoveRow(size_t(0));
+    doc.RemoveRow(size_t(0));
+    ExpectException(instrumentIdx.RemoveRow(0), std::out_of_range);
+    unittest::ExpectEqual(bool, instrumentDateIdx.IsValid(), false);
+    instrumentIdx.RemoveRows(0, 2);
+    abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 1, 2 }));
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowIdxs({ "GHI" })[0], 3);
+
+    // several rows inserted by one call
+    doc.AppendRows<int, std::string, std::string>({ { 7, "ABC", "2024-01-05" }, { 8, "JKL", "2024-01-05" } });
+    instrumentIdx.InsertRows(4, 2);
+    abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 1, 2, 4 }));
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowIdxs({ "JKL" })[0], 5);
+
+    // cell updates are replayed by Refresh(), key cells re-key the row
+    rapidcsv::HashIndex<std::string> instrumentIdxCopy(instrumentIdx);
+    doc.SetCell<std::string>("Instrument", 0, "ABC");
+    doc.SetCell<int>("Id", 3, 60);
+    unittest::ExpectEqual(bool, instrumentIdx.IsValid(), false);
+    ExpectException(instrumentIdx.InsertRows(0, 1), std::out_of_range);
+    instrumentIdx.Refresh();
+    abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 0, 1, 2, 4 }));
+    unittest::ExpectEqual(bool, instrumentIdx.Contains({ "XYZ" }), false);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetKeyCount(), 3);
+
+    // removal of the last rows
+    doc.RemoveRow(size_t(5));
+    doc.RemoveRow(size_t(4));
+    instrumentIdx.RemoveRows(4, 2);
+    unittest::ExpectEqual(bool, instrumentIdx.Contains({ "JKL" }), false);
+    unittest::ExpectEqual(size_t, instrumentIdx.GetRowCount(), 4);
+
+    // insert, remove and update replayed in order
+    doc.InsertRow<int, std::string, std::string>(0, std::make_tuple(9, "MNO", "2024-01-06"));
+    doc.RemoveRow(size_t(2));
+    doc.SetCell<std::string>("Instrument", 3, "MNO");
+    instrumentIdx.Refresh();
+    std::span<const size_t> mnoRows = instrumentIdx.GetRowIdxs({ "MNO" });
+    unittest::ExpectTrue(std::vector<size_t>(mnoRows.begin(), mnoRows.end()) == std::vector<size_t>({ 0, 3 }));
+    abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 1, 2 }));
+    unittest::ExpectEqual(size_t, instrumentIdx.GetKeyCount(), 2);
+
+    // a copy is refreshed independently, same as an index created anew
+    instrumentIdxCopy.Refresh();
+    instrumentDateIdx.Refresh();
+    rapidcsv::HashIndex<std::string> instrumentIdxNew(doc, "Instrument");
+    for (const std::string instrument : { "ABC", "MNO" })
+    {
+      const std::span<const size_t> rowsCopy = instrumentIdxCopy.GetRowIdxs({ instrument });
+      const std::span<const size_t> rowsNew = instrumentIdxNew.GetRowIdxs({ instrument });
+      unittest::ExpectTrue(std::vector<size_t>(rowsCopy.begin(), rowsCopy.end()) == std::vector<size_t>(rowsNew.begin(), rowsNew.end()));
+    }
+    unittest::ExpectEqual(size_t, instrumentIdxCopy.GetKeyCount(), instrumentIdxNew.GetKeyCount());
+    abcDayRows = instrumentDateIdx.GetRowIdxs({ "ABC", 2024y/1/2 });
+    unittest::ExpectTrue(std::vector<size_t>(abcDayRows.begin(), abcDayRows.end()) == std::vector<size_t>({ 1, 2 }));
+
+    // columns inserted/removed before the key column, the column name is resolved again on rebuild
+    doc.InsertColumn<std::string>(0, std::vector<std::string>(doc.GetRowCount(), "x"), "New");
+    unittest::ExpectEqual(bool, instrumentIdx.IsValid(), false);
+    instrumentIdx.Refresh();
+    abcRows = instrumentIdx.GetRowIdxs({ "ABC" });
+    unittest::ExpectTrue(std::vector<size_t>(abcRows.begin(), abcRows.end()) == std::vector<size_t>({ 1, 2 }));
+    unittest::ExpectTrue(instrumentIdx.GetRowIdxs({ "x" }).empty());
+    doc.RemoveColumn("New");
+    doc.RemoveColumn("Id");
+    instrumentIdx.Refresh();
+    mnoRows = instrumentIdx.GetRowIdxs({ "MNO" });
+    unittest::ExpectTrue(std::vector<size_t>(mnoRows.begin(), mnoRows.end()) == std::vector<size_t>({ 0, 3 }));
+    unittest::ExpectEqual(size_t, instrumentIdx.GetKeyCount(), 2);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
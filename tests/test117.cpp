@@ -0,0 +1,147 @@
+// test117.cpp - parallel group-by aggregation
+
+#include <climits>
+#include <cmath>
+#include <map>
+#include <rapidcsv/aggregate.h>
+#include "unittest.h"
+
+bool isEvenId(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 0;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Instrument,Volume,Price\n";
+  for (int id = 0; id < 10000; ++id)
+  {
+    csv += std::to_string(id) + ",i" + std::to_string((id * 7) % 13) + "," + std::to_string((id * 31) % 97) +
+           "," + std::to_string(id % 5) + ".5\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    const std::vector<int> ids = doc.GetColumn<int>("Id");
+    const std::vector<std::string> instruments = doc.GetColumn<std::string>("Instrument");
+    const std::vector<long> volumes = doc.GetColumn<long>("Volume");
+    std::map<std::string, long> expSum;
+    std::map<std::string, long> expCount;
+    std::map<std::string, long> expMin;
+    std::map<std::string, long> expMax;
+    std::map<std::string, double> expPriceSum;
+    const std::vector<double> prices = doc.GetColumn<double>("Price");
+    for (size_t rowIdx = 0; rowIdx < ids.size(); ++rowIdx)
+    {
+      const std::string& key = instruments[rowIdx];
+      expMin[key] = expCount[key] == 0 ? volumes[rowIdx] : std::min(expMin[key], volumes[rowIdx]);
+      expMax[key] = expCount[key] == 0 ? volumes[rowIdx] : std::max(expMax[key], volumes[rowIdx]);
+      expSum[key] += volumes[rowIdx];
+      expPriceSum[key] += prices[rowIdx];
+      ++expCount[key];
+    }
+
+    rapidcsv::AggregateParams<long, rapidcsv::e_AggregateOp::AGG_SUM> sumVolume("Volume");
+    rapidcsv::AggregateParams<long, rapidcsv::e_AggregateOp::AGG_MIN> minVolume("Volume");
+    rapidcsv::AggregateParams<long, rapidcsv::e_AggregateOp::AGG_MAX> maxVolume(2, "MaxVol");
+    rapidcsv::AggregateParams<int, rapidcsv::e_AggregateOp::AGG_COUNT> countRows("Id");
+    rapidcsv::AggregateParams<double, rapidcsv::e_AggregateOp::AGG_MEAN> meanPrice("Price");
+
+    for (const size_t threadCount : { size_t(1), size_t(4) })
+    {
+      rapidcsv::GroupBy<std::string> groupBy(rapidcsv::GroupByParams(threadCount, 100), "Instrument");
+      rapidcsv::Document result = groupBy.Aggregate(doc, sumVolume, minVolume, maxVolume, countRows, meanPrice);
+
+      unittest::ExpectEqual(size_t, result.GetRowCount(), 13);
+      unittest::ExpectEqual(size_t, result.GetColumnCount(), 6);
+      unittest::ExpectTrue(result.GetColumnNames() ==
+                           std::vector<std::string>({ "Instrument", "sum(Volume)", "min(Volume)", "MaxVol", "count(Id)", "mean(Price)" }));
+      // groups in order of first row
+      unittest::ExpectEqual(std::string, result.GetCell<std::string>(0, 0), "i0");
+      unittest::ExpectEqual(std::string, result.GetCell<std::string>(0, 1), "i7");
+      for (size_t rowIdx = 0; rowIdx < result.GetRowCount(); ++rowIdx)
+      {
+        const std::string key = result.GetCell<std::string>("Instrument", rowIdx);
+        unittest::ExpectEqual(long, result.GetCell<long>("sum(Volume)", rowIdx), expSum[key]);
+        unittest::ExpectEqual(long, result.GetCell<long>("min(Volume)", rowIdx), expMin[key]);
+        unittest::ExpectEqual(long, result.GetCell<long>("MaxVol", rowIdx), expMax[key]);
+        unittest::ExpectEqual(long, result.GetCell<long>("count(Id)", rowIdx), expCount[key]);
+        unittest::ExpectTrue(std::abs(result.GetCell<double>("mean(Price)", rowIdx) - expPriceSum[key] / static_cast<double>(expCount[key])) < 1e-9);
+      }
+    }
+
+    // two key columns over a filtered view
+    rapidcsv::FilterDocument<isEvenId> evendoc(doc);
+    rapidcsv::GroupBy<std::string, long> groupByBoth(rapidcsv::GroupByParams(3, 10), "Instrument", "Volume");
+    rapidcsv::Document resultBoth = groupByBoth.Aggregate(evendoc, countRows);
+    size_t total = 0;
+    for (size_t rowIdx = 0; rowIdx < resultBoth.GetRowCount(); ++rowIdx)
+    {
+      total += resultBoth.GetCell<size_t>("count(Id)", rowIdx);
+    }
+    unittest::ExpectEqual(size_t, total, 5000);
+    unittest::ExpectEqual(std::string, resultBoth.GetCell<std::string>("Volume", 1), "62");
+
+    // sorted view, groups in view order
+    rapidcsv::SortParams<long, rapidcsv::e_SortOrder::DESCEND> spVolume(2);
+    rapidcsv::SortParams<int> spId(0);
+    rapidcsv::SortDocument<decltype(spVolume), decltype(spId)> sortdoc(doc, spVolume, spId);
+    rapidcsv::Document resultSorted = rapidcsv::GroupBy<long>("Volume").Aggregate(sortdoc, countRows);
+    unittest::ExpectEqual(long, resultSorted.GetCell<long>("Volume", 0), 96);
+
+    ExpectException(rapidcsv::GroupBy<std::string>("Missing").Aggregate(doc, countRows), std::out_of_range);
+
+    // sum of an 'int' column beyond INT_MAX
+    rapidcsv::Document bigdoc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    bigdoc.SetColumn<int>("Volume", std::vector<int>(ids.size(), 2000000000));
+    rapidcsv::AggregateParams<int, rapidcsv::e_AggregateOp::AGG_SUM> sumIntVolume("Volume");
+    static_assert(std::is_same_v<decltype(sumIntVolume)::sum_type, int64_t>);
+    rapidcsv::Document resultBig = rapidcsv::GroupBy<std::string>(rapidcsv::GroupByParams(4, 100), "Instrument").Aggregate(bigdoc, sumIntVolume);
+    int64_t bigTotal = 0;
+    for (size_t rowIdx = 0; rowIdx < resultBig.GetRowCount(); ++rowIdx)
+    {
+      const int64_t groupSum = resultBig.GetCell<int64_t>("sum(Volume)", rowIdx);
+      unittest::ExpectTrue(groupSum > INT_MAX);
+      bigTotal += groupSum;
+    }
+    unittest::ExpectEqual(int64_t, bigTotal, int64_t(2000000000) * static_cast<int64_t>(ids.size()));
+
+    // cells failing conversion are skipped by sum and mean of a 'ConvertFromStr_gNaN' column
+    std::istringstream nanStream("Key,Value\nA,1.5\nA,n/a\nB,x\nA,2.5\n");
+    rapidcsv::Document nandoc(nanStream, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    rapidcsv::AggregateParams<converter::ConvertFromStr_gNaN<double>, rapidcsv::e_AggregateOp::AGG_SUM> sumNaN("Value");
+    rapidcsv::AggregateParams<converter::ConvertFromStr_gNaN<double>, rapidcsv::e_AggregateOp::AGG_MEAN> meanNaN("Value");
+    rapidcsv::AggregateParams<std::string, rapidcsv::e_AggregateOp::AGG_COUNT> countNaN("Value");
+    rapidcsv::Document resultNaN = rapidcsv::GroupBy<std::string>("Key").Aggregate(nandoc, sumNaN, meanNaN, countNaN);
+    unittest::ExpectEqual(size_t, resultNaN.GetRowCount(), 2);
+    unittest::ExpectEqual(double, resultNaN.GetCell<double>("sum(Value)", 0), 4.0);
+    unittest::ExpectEqual(double, resultNaN.GetCell<double>("mean(Value)", 0), 2.0);
+    unittest::ExpectEqual(size_t, resultNaN.GetCell<size_t>("count(Value)", 0), 3);
+    unittest::ExpectEqual(double, resultNaN.GetCell<double>("sum(Value)", 1), 0.0);
+
+    // without column names, result columns are named by column index
+    std::istringstream noLabelStream("A,1\nB,2\nA,3\n");
+    rapidcsv::Document nolabeldoc(noLabelStream, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_MISSING, rapidcsv::FlgRowName::RN_MISSING));
+    rapidcsv::Document resultNoLabel =
+      rapidcsv::GroupBy<std::string>(0).Aggregate(nolabeldoc, rapidcsv::AggregateParams<int, rapidcsv::e_AggregateOp::AGG_SUM>(1));
+    unittest::ExpectTrue(resultNoLabel.GetColumnNames() == std::vector<std::string>({ "0", "sum(1)" }));
+    unittest::ExpectEqual(int, resultNoLabel.GetCell<int>("sum(1)", 0), 4);
+    unittest::ExpectEqual(int, resultNoLabel.GetCell<int>("sum(1)", 1), 2);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,141 @@
+// test118.cpp - hash join and sort-merge join
+
+#include <algorithm>
+#include <rapidcsv/join.h>
+#include "unittest.h"
+
+bool isBuy(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return dataRow.at(2) == "B";
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csvTrades =
+    "TradeId,Instrument,Side,Quantity\n"
+    "0,ABC,B,10\n"
+    "1,XYZ,S,20\n"
+    "2,QQQ,B,30\n"
+    "3,ABC,S,40\n"
+    "4,DEF,B,50\n"
+  ;
+
+  std::string csvRefData =
+    "Instrument,Currency,Exchange\n"
+    "DEF,EUR,XETR\n"
+    "ABC,USD,XNYS\n"
+    "XYZ,GBP,XLON\n"
+    "ABC,USD,XNAS\n"
+  ;
+
+  std::string pathTrades = unittest::TempPath();
+  unittest::WriteFile(pathTrades, csvTrades);
+  std::string pathRefData = unittest::TempPath();
+  unittest::WriteFile(pathRefData, csvRefData);
+
+  try
+  {
+    const rapidcsv::LabelParams labelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING);
+    rapidcsv::Document trades(pathTrades, labelParams);
+    rapidcsv::Document refData(pathRefData, labelParams);
+
+    const rapidcsv::JoinKeyParams<std::string> tradeKey("Instrument");
+    const rapidcsv::JoinKeyParams<std::string> refKey(0);
+
+    // inner
+    rapidcsv::JoinDocument inner = rapidcsv::HashJoin(trades, tradeKey, refData, refKey);
+    unittest::ExpectEqual(size_t, inner.GetRowCount(), 6);
+    unittest::ExpectEqual(int, inner.GetJoinType(), rapidcsv::e_JoinType::JOIN_INNER);
+    const std::vector<std::pair<size_t, size_t>> expInner = { { 0, 1 }, { 0, 3 }, { 1, 2 }, { 3, 1 }, { 3, 3 }, { 4, 0 } };
+    const std::span<const std::pair<size_t, size_t>> innerPairs = inner.GetRowIdxPairs();
+    unittest::ExpectTrue(std::equal(innerPairs.begin(), innerPairs.end(), expInner.begin(), expInner.end()));
+    unittest::ExpectEqual(std::string, inner.GetRightCell<std::string>("Exchange", 1), "XNAS");
+    unittest::ExpectEqual(int, inner.GetLeftCell<int>("Quantity", 5), 50);
+
+    // left
+    rapidcsv::JoinDocument left = rapidcsv::HashJoin(trades, tradeKey, refData, refKey, rapidcsv::e_JoinType::JOIN_LEFT);
+    unittest::ExpectEqual(size_t, left.GetRowCount(), 7);
+    unittest::ExpectEqual(size_t, left.GetLeftRowIdx(3), 2);
+    unittest::ExpectEqual(size_t, left.GetRightRowIdx(3), rapidcsv::JoinDocument::npos);
+    ExpectException(left.GetRightCell<std::string>("Currency", 3), std::out_of_range);
+
+    // semi, on a filtered view and with an existing hash index
+    rapidcsv::FilterDocument<isBuy> buys(trades);
+    rapidcsv::HashIndex<std::string> refIndex(refData, "Instrument");
+    rapidcsv::JoinDocument semi = rapidcsv::HashJoin(buys, tradeKey, refIndex, rapidcsv::e_JoinType::JOIN_SEMI);
+    unittest::ExpectEqual(size_t, semi.GetRowCount(), 2);
+    unittest::ExpectEqual(size_t, semi.GetLeftRowIdx(0), 0);
+    unittest::ExpectEqual(size_t, semi.GetLeftRowIdx(1), 4);
+
+    // sort-merge join on sort-views, on the first SortParams
+    rapidcsv::SortParams<std::string> spTradeInstrument(1);
+    rapidcsv::SortDocument<decltype(spTradeInstrument)> tradesByInstrument(trades, spTradeInstrument);
+    rapidcsv::SortParams<std::string> spRefInstrument(0);
+    rapidcsv::SortDocument<decltype(spRefInstrument)> refByInstrument(refData, spRefInstrument);
+    rapidcsv::JoinDocument merged = rapidcsv::MergeJoin<1>(tradesByInstrument, refByInstrument, rapidcsv::e_JoinType::JOIN_LEFT);
+    unittest::ExpectEqual(size_t, merged.GetRowCount(), 4);
+    unittest::ExpectEqual(std::string, merged.GetLeftCell<std::string>("Instrument", 0), "ABC");
+    unittest::ExpectEqual(std::string, merged.GetRightCell<std::string>("Exchange", 0), "XNAS");
+    unittest::ExpectEqual(std::string, merged.GetRightCell<std::string>("Currency", 1), "EUR");
+    unittest::ExpectEqual(size_t, merged.GetRightRowIdx(2), rapidcsv::JoinDocument::npos);
+    unittest::ExpectEqual(std::string, merged.GetRightCell<std::string>("Exchange", 3), "XLON");
+
+    rapidcsv::JoinDocument mergedInner = rapidcsv::MergeJoin<1>(tradesByInstrument, refByInstrument);
+    unittest::ExpectEqual(size_t, mergedInner.GetRowCount(), 3);
+
+    // many-to-one : trailing trade-id keeps trades of same instrument, same as hash join on the views
+    rapidcsv::SortParams<int> spTradeId(0);
+    rapidcsv::SortDocument<decltype(spTradeInstrument), decltype(spTradeId)> tradesByInstrumentId(trades, spTradeInstrument, spTradeId);
+    for (const rapidcsv::e_JoinType joinType : { rapidcsv::e_JoinType::JOIN_INNER, rapidcsv::e_JoinType::JOIN_LEFT, rapidcsv::e_JoinType::JOIN_SEMI })
+    {
+      rapidcsv::JoinDocument mergedAll = rapidcsv::MergeJoin<1>(tradesByInstrumentId, refByInstrument, joinType);
+      rapidcsv::JoinDocument hashedAll = rapidcsv::HashJoin(tradesByInstrumentId, tradeKey, refByInstrument, refKey, joinType);
+      const std::span<const std::pair<size_t, size_t>> mergedPairs = mergedAll.GetRowIdxPairs();
+      const std::span<const std::pair<size_t, size_t>> hashedPairs = hashedAll.GetRowIdxPairs();
+      unittest::ExpectTrue(std::equal(mergedPairs.begin(), mergedPairs.end(), hashedPairs.begin(), hashedPairs.end()));
+    }
+    rapidcsv::JoinDocument mergedAll = rapidcsv::MergeJoin<1>(tradesByInstrumentId, refByInstrument);
+    unittest::ExpectEqual(size_t, mergedAll.GetRowCount(), 4);
+    unittest::ExpectEqual(size_t, mergedAll.GetLeftRowIdx(0), 0);
+    unittest::ExpectEqual(size_t, mergedAll.GetLeftRowIdx(1), 3);
+    unittest::ExpectEqual(std::string, mergedAll.GetRightCell<std::string>("Exchange", 1), "XNAS");
+
+    // one-to-many and many-to-many : trailing exchange keeps ref rows of same instrument, same as hash join
+    rapidcsv::SortParams<std::string> spRefExchange(2);
+    rapidcsv::SortDocument<decltype(spRefInstrument), decltype(spRefExchange)> refByInstrumentExchange(refData, spRefInstrument, spRefExchange);
+    for (const rapidcsv::e_JoinType joinType : { rapidcsv::e_JoinType::JOIN_INNER, rapidcsv::e_JoinType::JOIN_LEFT, rapidcsv::e_JoinType::JOIN_SEMI })
+    {
+      for (const bool isUniqueLeft : { false, true })
+      {
+        rapidcsv::JoinDocument mergedMany = isUniqueLeft ? rapidcsv::MergeJoin<1>(tradesByInstrument, refByInstrumentExchange, joinType)
+                                                         : rapidcsv::MergeJoin<1>(tradesByInstrumentId, refByInstrumentExchange, joinType);
+        rapidcsv::JoinDocument hashedMany = isUniqueLeft ? rapidcsv::HashJoin(tradesByInstrument, tradeKey, refByInstrumentExchange, refKey, joinType)
+                                                         : rapidcsv::HashJoin(tradesByInstrumentId, tradeKey, refByInstrumentExchange, refKey, joinType);
+        const std::span<const std::pair<size_t, size_t>> mergedPairs = mergedMany.GetRowIdxPairs();
+        const std::span<const std::pair<size_t, size_t>> hashedPairs = hashedMany.GetRowIdxPairs();
+        unittest::ExpectTrue(std::equal(mergedPairs.begin(), mergedPairs.end(), hashedPairs.begin(), hashedPairs.end()));
+      }
+    }
+    rapidcsv::JoinDocument mergedMany = rapidcsv::MergeJoin<1>(tradesByInstrumentId, refByInstrumentExchange, rapidcsv::e_JoinType::JOIN_LEFT);
+    unittest::ExpectEqual(size_t, mergedMany.GetRowCount(), 7);
+    unittest::ExpectEqual(size_t, mergedMany.GetLeftRowIdx(0), 0);
+    unittest::ExpectEqual(std::string, mergedMany.GetRightCell<std::string>("Exchange", 0), "XNAS");
+    unittest::ExpectEqual(size_t, mergedMany.GetLeftRowIdx(1), 0);
+    unittest::ExpectEqual(std::string, mergedMany.GetRightCell<std::string>("Exchange", 1), "XNYS");
+    unittest::ExpectEqual(size_t, mergedMany.GetLeftRowIdx(2), 3);
+    unittest::ExpectEqual(size_t, mergedMany.GetLeftRowIdx(3), 3);
+    unittest::ExpectEqual(size_t, mergedMany.GetRightRowIdx(5), rapidcsv::JoinDocument::npos);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(pathTrades);
+  unittest::DeleteFile(pathRefData);
+
+  return rv;
+}
@@ -0,0 +1,93 @@
+// test119.cpp - as-of join of sort-views
+
+#include <rapidcsv/join.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csvTrades =
+    "TradeId,Symbol,Time\n"
+    "0,ABC,100\n"
+    "1,XYZ,105\n"
+    "2,ABC,110\n"
+    "3,ABC,110\n"
+    "4,XYZ,90\n"
+    "5,ABC,95\n"
+    "6,DEF,120\n"
+  ;
+
+  std::string csvQuotes =
+    "Symbol,Time,Bid\n"
+    "ABC,98,1.1\n"
+    "XYZ,100,2.1\n"
+    "ABC,110,1.3\n"
+    "ABC,104,1.2\n"
+    "XYZ,106,2.2\n"
+  ;
+
+  std::string pathTrades = unittest::TempPath();
+  unittest::WriteFile(pathTrades, csvTrades);
+  std::string pathQuotes = unittest::TempPath();
+  unittest::WriteFile(pathQuotes, csvQuotes);
+
+  try
+  {
+    const rapidcsv::LabelParams labelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING);
+    rapidcsv::Document trades(pathTrades, labelParams);
+    rapidcsv::Document quotes(pathQuotes, labelParams);
+
+    // partitioned by symbol, trade-id keeps trades with equal time distinct
+    rapidcsv::SortParams<std::string> spTradeSymbol(1);
+    rapidcsv::SortParams<int> spTradeTime(2);
+    rapidcsv::SortParams<int> spTradeId(0);
+    rapidcsv::SortDocument<decltype(spTradeSymbol), decltype(spTradeTime), decltype(spTradeId)>
+      tradeView(trades, spTradeSymbol, spTradeTime, spTradeId);
+    rapidcsv::SortParams<std::string> spQuoteSymbol(0);
+    rapidcsv::SortParams<int> spQuoteTime(1);
+    rapidcsv::SortDocument<decltype(spQuoteSymbol), decltype(spQuoteTime)> quoteView(quotes, spQuoteSymbol, spQuoteTime);
+
+    rapidcsv::JoinDocument asof = rapidcsv::AsOfJoin<1>(tradeView, quoteView, rapidcsv::e_JoinType::JOIN_LEFT);
+    unittest::ExpectEqual(size_t, asof.GetRowCount(), 7);
+    // trade-id -> bid
+    const std::vector<std::pair<int, std::string>> expected =
+      { { 5, "" }, { 0, "1.1" }, { 2, "1.3" }, { 3, "1.3" }, { 6, "" }, { 4, "" }, { 1, "2.1" } };
+    for (size_t rowIdx = 0; rowIdx < expected.size(); ++rowIdx)
+    {
+      unittest::ExpectEqual(int, asof.GetLeftCell<int>("TradeId", rowIdx), expected[rowIdx].first);
+      if (expected[rowIdx].second.empty())
+      {
+        unittest::ExpectEqual(size_t, asof.GetRightRowIdx(rowIdx), rapidcsv::JoinDocument::npos);
+      } else {
+        unittest::ExpectEqual(std::string, asof.GetRightCell<std::string>("Bid", rowIdx), expected[rowIdx].second);
+      }
+    }
+
+    // strictly before
+    rapidcsv::JoinDocument asofStrict = rapidcsv::AsOfJoin<1>(tradeView, quoteView, rapidcsv::e_JoinType::JOIN_INNER, false);
+    unittest::ExpectEqual(size_t, asofStrict.GetRowCount(), 4);
+    unittest::ExpectEqual(std::string, asofStrict.GetRightCell<std::string>("Bid", 1), "1.2");
+
+    // no partition
+    rapidcsv::SortDocument<decltype(spTradeTime), decltype(spTradeId)> tradeTimeView(trades, spTradeTime, spTradeId);
+    rapidcsv::SortDocument<decltype(spQuoteTime)> quoteTimeView(quotes, spQuoteTime);
+    rapidcsv::JoinDocument asofAll = rapidcsv::AsOfJoin(tradeTimeView, quoteTimeView);
+    unittest::ExpectEqual(size_t, asofAll.GetRowCount(), 5);
+    unittest::ExpectEqual(int, asofAll.GetLeftCell<int>("TradeId", 0), 0);
+    unittest::ExpectEqual(std::string, asofAll.GetRightCell<std::string>("Bid", 0), "2.1");
+    unittest::ExpectEqual(std::string, asofAll.GetRightCell<std::string>("Bid", 1), "1.2");
+    unittest::ExpectEqual(int, asofAll.GetLeftCell<int>("TradeId", 4), 6);
+    unittest::ExpectEqual(std::string, asofAll.GetRightCell<std::string>("Bid", 4), "1.3");
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(pathTrades);
+  unittest::DeleteFile(pathQuotes);
+
+  return rv;
+}
@@ -0,0 +1,162 @@
+// test120.cpp - views over views
+
+#include <rapidcsv/filterexpr.h>
+#include <rapidcsv/view.h>
+#include <thread>
+#include "unittest.h"
+
+bool isN3(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return dataRow.at(1) == "n3";
+}
+
+bool isEvenId(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 0;
+}
+
+std::vector<size_t> documentRowIdxs(const rapidcsv::_ViewDocument& view)
+{
+  std::vector<size_t> rowIdxs;
+  for (size_t viewRowIdx = 0; viewRowIdx < view.GetViewRowCount(); ++viewRowIdx)
+  {
+    rowIdxs.push_back(view.GetDocumentRowIdx(viewRowIdx));
+  }
+  return rowIdxs;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Key,Id,Name,Volume\n";
+  for (int id = 0; id < 300; ++id)
+  {
+    csv += "r" + std::to_string(id) + "," + std::to_string(id) + ",n" + std::to_string(id % 7) + "," +
+           std::to_string((id * 37) % 101) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    rapidcsv::SortParams<std::string> spName(1);
+    rapidcsv::SortParams<int> spId(0);
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spVolume(2);
+
+    rapidcsv::SortDocument<decltype(spName), decltype(spId)> byName(doc, spName, spId);
+    unittest::ExpectEqual(size_t, byName.GetViewRowCount(), 300);
+
+    // filter over a sort-view keeps the parent's order
+    rapidcsv::FilterDocument<isN3> n3ByName(byName);
+    unittest::ExpectEqual(size_t, n3ByName.GetViewRowCount(), 43);
+    unittest::ExpectEqual(int, n3ByName.GetViewCell<int>("Id", 0), 3);
+    unittest::ExpectEqual(int, n3ByName.GetViewCell<int>("Id", 42), 297);
+    unittest::ExpectEqual(size_t, n3ByName.GetViewRowIdx("r10"), 1);
+    unittest::ExpectEqual(size_t, n3ByName.GetDocumentRowIdx("r10"), 10);
+    ExpectException(n3ByName.GetViewRowIdx("r11"), std::out_of_range);
+
+    rapidcsv::FilterDocument<isEvenId> evenByName(byName);
+    rapidcsv::FilterSortDocument<isEvenId, decltype(spName), decltype(spId)> evenByNameDirect(doc, spName, spId);
+    unittest::ExpectTrue(documentRowIdxs(evenByName) == documentRowIdxs(evenByNameDirect));
+
+    // sort over a filter-view is same as filter-sort on the document
+    rapidcsv::FilterDocument<isN3> n3(doc);
+    rapidcsv::SortDocument<decltype(spVolume)> n3ByVolume(n3, spVolume);
+    rapidcsv::FilterSortDocument<isN3, decltype(spVolume)> n3ByVolumeDirect(doc, spVolume);
+    unittest::ExpectEqual(size_t, n3ByVolume.GetViewRowCount(), 43);
+    unittest::ExpectTrue(documentRowIdxs(n3ByVolume) == documentRowIdxs(n3ByVolumeDirect));
+    unittest::ExpectEqual(int, n3ByVolume.GetCell_IndexKey<int>("Id", std::make_tuple(10)), 3);
+    const std::pair<size_t, size_t> range = n3ByVolume.EqualRange(std::make_tuple(10));
+    unittest::ExpectEqual(size_t, range.second - range.first, 1);
+
+    // re-sort of a sort-view, on a different column
+    rapidcsv::SortDocument<decltype(spId)> byNameById(byName, spId);
+    for (size_t viewRowIdx = 0; viewRowIdx < byNameById.GetViewRowCount(); ++viewRowIdx)
+    {
+      unittest::ExpectEqual(size_t, byNameById.GetDocumentRowIdx(viewRowIdx), viewRowIdx);
+    }
+
+    // top-K over a view
+    rapidcsv::TopKSortDocument<decltype(spVolume)> n3Top5(n3, 5, spVolume);
+    rapidcsv::FilterTopKSortDocument<isN3, decltype(spVolume)> n3Top5Direct(doc, 5, spVolume);
+    unittest::ExpectEqual(size_t, n3Top5.GetViewRowCount(), 5);
+    unittest::ExpectTrue(documentRowIdxs(n3Top5) == documentRowIdxs(n3Top5Direct));
+
+    // runtime filter expression over a view, chained three levels deep
+    using rapidcsv::FilterExpr;
+    rapidcsv::ExprFilterDocument n3Volume50(n3ByVolume, FilterExpr::Compare<int>("Volume", rapidcsv::e_CompareOp::GREATER, 50));
+    std::vector<size_t> expected;
+    for (size_t viewRowIdx = 0; viewRowIdx < n3ByVolumeDirect.GetViewRowCount(); ++viewRowIdx)
+    {
+      if (n3ByVolumeDirect.GetViewCell<int>("Volume", viewRowIdx) > 50)
+      {
+        expected.push_back(n3ByVolumeDirect.GetDocumentRowIdx(viewRowIdx));
+      }
+    }
+    unittest::ExpectTrue(documentRowIdxs(n3Volume50) == expected);
+
+    rapidcsv::FilterDocument<isEvenId> evenN3Volume50(n3Volume50);
+    std::vector<size_t> expectedEven;
+    for (const size_t rowIdx : expected)
+    {
+      if ((rowIdx % 2) == 0)  expectedEven.push_back(rowIdx);
+    }
+    unittest::ExpectTrue(!expectedEven.empty());
+    unittest::ExpectTrue(documentRowIdxs(evenN3Volume50) == expectedEven);
+
+    // concurrent lookups by name on a fresh view, which builds its reverse map on first lookup
+    rapidcsv::FilterDocument<isN3> n3Shared(doc);
+    std::vector<std::vector<size_t>> threadViewRowIdxs(4);
+    std::vector<std::thread> threads;
+    for (std::vector<size_t>& viewRowIdxs : threadViewRowIdxs)
+    {
+      threads.emplace_back([&n3Shared, &viewRowIdxs]()
+      {
+        for (int id = 3; id < 300; id += 7)
+        {
+          viewRowIdxs.push_back(n3Shared.GetViewRowIdx("r" + std::to_string(id)));
+        }
+      });
+    }
+    for (std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    for (const std::vector<size_t>& viewRowIdxs : threadViewRowIdxs)
+    {
+      unittest::ExpectEqual(size_t, viewRowIdxs.size(), 43);
+      unittest::ExpectEqual(size_t, viewRowIdxs.at(42), 42);
+    }
+
+    // child view does not refer to its parent
+    std::unique_ptr<rapidcsv::FilterDocument<isN3>> pParent = std::make_unique<rapidcsv::FilterDocument<isN3>>(doc);
+    rapidcsv::FilterDocument<isEvenId> child(*pParent);
+    pParent.reset();
+    unittest::ExpectEqual(size_t, child.GetViewRowCount(), 21);
+    unittest::ExpectEqual(int, child.GetViewCell<int>("Id", 1), 24);
+
+    // copy of a view is a copy, not a filter over it as parent view
+    static_assert(std::is_copy_constructible_v<rapidcsv::FilterDocument<isN3>>);
+    static_assert(std::is_move_constructible_v<rapidcsv::FilterSortDocument<isN3, decltype(spVolume)>>);
+    static_assert(std::is_copy_constructible_v<rapidcsv::ExprFilterDocument>);
+    rapidcsv::FilterDocument<isN3> n3Copy(n3Shared);
+    unittest::ExpectTrue(documentRowIdxs(n3Copy) == documentRowIdxs(n3Shared));
+    unittest::ExpectEqual(size_t, n3Copy.GetViewRowIdx("r10"), 1);
+    rapidcsv::FilterSortDocument<isN3, decltype(spVolume)> n3ByVolumeMoved(std::move(n3ByVolumeDirect));
+    unittest::ExpectTrue(documentRowIdxs(n3ByVolumeMoved) == documentRowIdxs(n3ByVolume));
+    unittest::ExpectEqual(size_t, n3ByVolumeMoved.GetDocumentRowIdx("r3"), 3);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,184 @@
+// test121.cpp - row change log and incremental refresh of views
+
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+bool isEvenVolume(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(2)) % 2) == 0;
+}
+
+std::vector<size_t> documentRowIdxs(const rapidcsv::_ViewDocument& view)
+{
+  std::vector<size_t> rowIdxs;
+  for (size_t viewRowIdx = 0; viewRowIdx < view.GetViewRowCount(); ++viewRowIdx)
+  {
+    rowIdxs.push_back(view.GetDocumentRowIdx(viewRowIdx));
+  }
+  return rowIdxs;
+}
+
+template< typename V >
+bool isSameRows(const V& refreshedView, const rapidcsv::Document& doc)
+{
+  const V recreatedView(doc);
+  return documentRowIdxs(refreshedView) == documentRowIdxs(recreatedView);
+}
+
+template< typename V, typename SP >
+bool isSameRows(const V& refreshedView, const rapidcsv::Document& doc, const SP& sortParams)
+{
+  const V recreatedView(doc, sortParams);
+  return documentRowIdxs(refreshedView) == documentRowIdxs(recreatedView);
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Name,Volume\n";
+  for (int id = 0; id < 100; ++id)
+  {
+    csv += std::to_string(id) + ",n" + std::to_string(id % 7) + "," + std::to_string((id * 37) % 101) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    // change log
+    const size_t seq = doc.GetRowChangeSeq();
+    unittest::ExpectEqual(size_t, doc.GetRowChanges(seq).size(), 0);
+    doc.AppendRows_VecStr({ { "100", "n2", "4" }, { "101", "n3", "5" } });
+    doc.RemoveRow(3);
+    doc.SetCell<int>(2, 10, 77);
+    doc.InsertRow_VecStr(200, { "102", "n4", "6" });
+    const std::span<const rapidcsv::RowChange> changes = doc.GetRowChanges(seq);
+    unittest::ExpectEqual(size_t, changes.size(), 4);
+    unittest::ExpectEqual(int, changes[0].mChange, rapidcsv::ROWS_INSERTED);
+    unittest::ExpectEqual(size_t, changes[0].mRowIdx, 100);
+    unittest::ExpectEqual(size_t, changes[0].mRowCount, 2);
+    unittest::ExpectEqual(int, changes[1].mChange, rapidcsv::ROWS_REMOVED);
+    unittest::ExpectEqual(size_t, changes[1].mRowIdx, 3);
+    unittest::ExpectEqual(int, changes[2].mChange, rapidcsv::ROWS_UPDATED);
+    unittest::ExpectEqual(size_t, changes[2].mRowIdx, 10);
+    // padding rows up to index 200 are inserted too
+    unittest::ExpectEqual(size_t, changes[3].mRowIdx, 101);
+    unittest::ExpectEqual(size_t, changes[3].mRowCount, 100);
+    unittest::ExpectEqual(size_t, doc.GetRowChangeSeq(), seq + 4);
+    ExpectException(doc.GetRowChanges(seq + 5), std::out_of_range);
+    for (size_t rowIdx = 200; rowIdx > 101; --rowIdx)
+    {
+      doc.RemoveRow(rowIdx - 1);
+    }
+    unittest::ExpectEqual(size_t, doc.GetRowCount(), 102);
+
+    using t_filterView = rapidcsv::FilterDocument<isEvenVolume>;
+    using t_volumeSort = rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND>;
+    using t_sortView = rapidcsv::FilterSortDocument<isEvenVolume, t_volumeSort>;
+    using t_nameSort = rapidcsv::SortParams<std::string>;
+    using t_nameView = rapidcsv::SortDocument<t_nameSort>;
+    const t_volumeSort spVolume(2);
+    const t_nameSort spName(1);
+
+    t_filterView filterView(doc);
+    t_sortView sortView(doc, spVolume);
+    t_nameView nameView(doc, spName);
+    unittest::ExpectTrue(filterView.IsCurrent());
+    unittest::ExpectEqual(size_t, nameView.GetViewRowCount(), 7);
+
+    // append
+    doc.AppendRows_VecStr({ { "500", "n9", "200" }, { "501", "n1", "201" }, { "502", "n0", "202" } });
+    unittest::ExpectTrue(!filterView.IsCurrent());
+    filterView.Refresh();
+    sortView.Refresh();
+    nameView.Refresh();
+    unittest::ExpectTrue(filterView.IsCurrent());
+    unittest::ExpectTrue(isSameRows(filterView, doc));
+    unittest::ExpectTrue(isSameRows(sortView, doc, spVolume));
+    unittest::ExpectTrue(isSameRows(nameView, doc, spName));
+    unittest::ExpectEqual(int, sortView.GetViewCell<int>("Id", 0), 502);
+    unittest::ExpectEqual(size_t, nameView.GetViewRowCount(), 8);
+    unittest::ExpectEqual(int, nameView.GetCell_IndexKey<int>("Id", std::make_tuple(std::string("n0"))), 502);
+
+    // insert in the middle, remove, update, in one refresh
+    doc.InsertRow_VecStr(5, { "600", "n2", "300" });
+    doc.RemoveRow(20);
+    doc.SetCell<int>(2, 30, 1000);
+    doc.SetCell<int>(2, 31, 1001);
+    doc.SetRow_VecStr(0, { "0", "n0", "8" });
+    doc.InsertRows_VecStr(2, { { "601", "n1", "302" }, { "602", "n2", "303" } });
+    doc.RemoveRow(1);
+    filterView.Refresh();
+    sortView.Refresh();
+    unittest::ExpectTrue(isSameRows(filterView, doc));
+    unittest::ExpectTrue(isSameRows(sortView, doc, spVolume));
+    unittest::ExpectEqual(int, sortView.GetViewCell<int>("Volume", 0), 1000);
+    unittest::ExpectEqual(size_t, sortView.GetDocumentRowIdx(static_cast<size_t>(0)), 31);
+
+    // update of a view row having other rows with same sort-key, falls back to re-create
+    const size_t n0RowIdx = nameView.GetDocumentRowIdx(nameView.LowerBound(std::make_tuple(std::string("n0"))));
+    doc.SetCell<std::string>(1, n0RowIdx, "n8");
+    nameView.Refresh();
+    unittest::ExpectTrue(isSameRows(nameView, doc, spName));
+    unittest::ExpectEqual(size_t, nameView.GetViewRowCount(), 9);
+
+    // batch of new sort-keys : after all view rows, in the middle, and repeated among the new rows
+    using t_volumeAscSort = rapidcsv::SortParams<int>;
+    using t_volumeAscView = rapidcsv::SortDocument<t_volumeAscSort>;
+    const t_volumeAscSort spVolumeAsc(2);
+    t_volumeAscView volumeView(doc, spVolumeAsc);
+    const size_t volumeRowCount = volumeView.GetViewRowCount();
+    doc.AppendRows_VecStr({ { "700", "n1", "5000" }, { "701", "n2", "5001" }, { "702", "n3", "5000" } });
+    volumeView.Refresh();
+    unittest::ExpectTrue(isSameRows(volumeView, doc, spVolumeAsc));
+    unittest::ExpectEqual(size_t, volumeView.GetViewRowCount(), volumeRowCount + 2);
+    unittest::ExpectEqual(int, volumeView.GetViewCell<int>("Id", volumeRowCount), 702);
+    doc.AppendRows_VecStr({ { "703", "n4", "-1" }, { "704", "n5", "2500" }, { "705", "n6", "-1" }, { "706", "n0", "5002" } });
+    volumeView.Refresh();
+    unittest::ExpectTrue(isSameRows(volumeView, doc, spVolumeAsc));
+    unittest::ExpectEqual(int, volumeView.GetViewCell<int>("Id", 0), 705);
+    doc.RemoveRow(doc.GetRowCount() - 2);
+    volumeView.Refresh();
+    unittest::ExpectTrue(isSameRows(volumeView, doc, spVolumeAsc));
+    unittest::ExpectEqual(int, volumeView.GetViewCell<int>("Id", 0), 703);
+
+    // Clear / Load reset the log
+    filterView.Refresh();
+    doc.Load(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    unittest::ExpectEqual(int, doc.GetRowChanges(doc.GetRowChangeFirstSeq())[0].mChange, rapidcsv::ROWS_RESET);
+    filterView.Refresh();
+    sortView.Refresh();
+    unittest::ExpectTrue(isSameRows(filterView, doc));
+    unittest::ExpectTrue(isSameRows(sortView, doc, spVolume));
+
+    // changes dropped from the log re-create the view
+    const size_t refreshedSeq = doc.GetRowChangeSeq();
+    for (size_t count = 0; count <= rapidcsv::Document::s_RowChangeLogCapacity; ++count)
+    {
+      doc.SetCell<int>(2, count % 100, static_cast<int>(count));
+    }
+    unittest::ExpectTrue(doc.GetRowChangeFirstSeq() > refreshedSeq);
+    filterView.Refresh();
+    sortView.Refresh();
+    unittest::ExpectTrue(isSameRows(filterView, doc));
+    unittest::ExpectTrue(isSameRows(sortView, doc, spVolume));
+
+    // view over a view can't be refreshed
+    nameView.Refresh();
+    rapidcsv::FilterDocument<isEvenVolume> childView(nameView);
+    ExpectException(childView.Refresh(), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
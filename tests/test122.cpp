@@ -0,0 +1,100 @@
+// test122.cpp - row ranges over Document and views
+
+#include <algorithm>
+#include <ranges>
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+bool isOddId(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 1;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Id,Name,Volume\n";
+  for (int id = 0; id < 50; ++id)
+  {
+    csv += std::to_string(id) + ",n" + std::to_string(id % 7) + "," + std::to_string((id * 37) % 101) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    using t_rowRange = rapidcsv::RowRange<int, std::string, int>;
+    static_assert(std::ranges::random_access_range<t_rowRange>);
+    static_assert(std::ranges::sized_range<t_rowRange>);
+    static_assert(std::ranges::view<t_rowRange>);
+    static_assert(std::ranges::borrowed_range<t_rowRange>);
+
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+
+    // Document rows
+    const t_rowRange rows = doc.GetRowRange<int, std::string, int>();
+    unittest::ExpectEqual(size_t, rows.size(), 50);
+    int idSum = 0;
+    size_t rowIdx = 0;
+    for (const auto [id, name, volume] : rows)
+    {
+      idSum += id;
+      unittest::ExpectEqual(std::string, name, doc.GetCell<std::string>("Name", rowIdx));
+      unittest::ExpectEqual(int, volume, doc.GetCell<int>("Volume", rowIdx));
+      ++rowIdx;
+    }
+    unittest::ExpectEqual(int, idSum, 49 * 50 / 2);
+
+    const auto volumeOf = [](const rapidcsv::RowProxy<int, std::string, int>& row) { return row.get<2>(); };
+    const auto itMax = std::ranges::max_element(rows, {}, volumeOf);
+    unittest::ExpectEqual(int, (*itMax).get<2>(), 100);
+    unittest::ExpectEqual(size_t, (*itMax).GetRowIdx(), 30);
+    unittest::ExpectEqual(std::string, std::string(rows[30][1]), "n2");
+    unittest::ExpectEqual(size_t, rows[30].size(), 3);
+    const long n3Count = std::ranges::count_if(rows, [](const auto& row) { return row[1] == "n3"; });
+    unittest::ExpectEqual(long, n3Count, 7);
+
+    // view rows, in view order
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spVolume(2);
+    rapidcsv::FilterSortDocument<isOddId, decltype(spVolume)> viewdoc(doc, spVolume);
+    const auto viewRows = viewdoc.GetViewRowRange<int>();
+    unittest::ExpectEqual(size_t, viewRows.size(), viewdoc.GetViewRowCount());
+    size_t viewRowIdx = 0;
+    for (const auto row : viewRows)
+    {
+      unittest::ExpectEqual(size_t, row.GetRowIdx(), viewdoc.GetDocumentRowIdx(viewRowIdx));
+      unittest::ExpectEqual(int, row.get<0>(), viewdoc.GetViewCell<int>("Id", viewRowIdx));
+      unittest::ExpectEqual(std::string, std::string(row[2]), viewdoc.GetViewCell<std::string>("Volume", viewRowIdx));
+      ++viewRowIdx;
+    }
+    unittest::ExpectEqual(size_t, viewRowIdx, 25);
+
+    // composes with range adaptors
+    auto lowest3 = viewRows | std::views::reverse | std::views::take(3);
+    std::vector<int> lowestIds;
+    std::ranges::transform(lowest3, std::back_inserter(lowestIds), [](const auto& row) { return row.template get<0>(); });
+    unittest::ExpectEqual(size_t, lowestIds.size(), 3);
+    unittest::ExpectEqual(int, lowestIds[0], viewdoc.GetViewCell<int>("Id", static_cast<size_t>(24)));
+    unittest::ExpectEqual(int, lowestIds[2], viewdoc.GetViewCell<int>("Id", static_cast<size_t>(22)));
+    unittest::ExpectEqual(long, viewRows.end() - viewRows.begin(), 25);
+    unittest::ExpectEqual(int, viewRows.back().get<0>(), lowestIds[0]);
+
+    // cells beyond the row
+    doc.InsertRow_VecStr(50, { "50" });
+    const auto shortRow = doc.GetRowRange<int, std::string>()[50];
+    unittest::ExpectEqual(int, shortRow.get<0>(), 50);
+    ExpectException(shortRow.get<1>(), std::out_of_range);
+    ExpectException(shortRow.at(1), std::out_of_range);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,91 @@
+// test123.cpp - sort columns of views are read from the cached sort-keys
+
+#include <rapidcsv/view.h>
+#include "unittest.h"
+
+bool isOddId(const rapidcsv::Document::t_dataRow& dataRow)
+{
+  return (std::stoi(dataRow.at(0)) % 2) == 1;
+}
+
+template< typename V, typename T_C >
+bool isSameAsDocument(const V& view, const rapidcsv::Document& doc, const size_t columnIdx)
+{
+  const std::vector<typename converter::t_S2Tconv_c<T_C>::return_type> column = view.template GetViewColumn<T_C>(columnIdx);
+  if (column.size() != view.GetViewRowCount())  return false;
+  for (size_t viewRowIdx = 0; viewRowIdx < column.size(); ++viewRowIdx)
+  {
+    const auto cell = doc.GetCell<T_C>(columnIdx, view.GetDocumentRowIdx(viewRowIdx));
+    if ( (column[viewRowIdx] != cell) || (view.template GetViewCell<T_C>(columnIdx, viewRowIdx) != cell) )  return false;
+  }
+  return true;
+}
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "Key,Id,Name,Volume,Price\n";
+  for (int id = 0; id < 60; ++id)
+  {
+    csv += "r" + std::to_string(id) + "," + std::to_string(id) + ",n" + std::to_string(id % 7) + "," +
+           std::to_string((id * 37) % 101) + "," + ((id % 10) == 4 ? std::string("na") : std::to_string(id * 3)) + "\n";
+  }
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_PRESENT));
+
+    using t_priceConv = converter::ConvertFromStr<int, converter::S2T_Format_std_StoT<int, converter::FailureS2Tprocess::VARIANT_NAN>>;
+    rapidcsv::SortParams<int, rapidcsv::e_SortOrder::DESCEND> spVolume(2);
+    rapidcsv::SortParams<std::string> spName(1);
+    rapidcsv::SortParams<t_priceConv> spPrice(3);
+    rapidcsv::FilterSortDocument<isOddId, decltype(spName), decltype(spVolume)> byNameVolume(doc, spName, spVolume);
+    rapidcsv::SortDocument<decltype(spPrice)> byPrice(doc, spPrice);
+    unittest::ExpectEqual(size_t, spVolume.getColumnIndex(), 2);
+
+    // sort columns, and other columns, in view order
+    unittest::ExpectTrue((isSameAsDocument<decltype(byNameVolume), std::string>(byNameVolume, doc, 1)));
+    unittest::ExpectTrue((isSameAsDocument<decltype(byNameVolume), int>(byNameVolume, doc, 2)));
+    unittest::ExpectTrue((isSameAsDocument<decltype(byNameVolume), int>(byNameVolume, doc, 0)));
+    unittest::ExpectTrue((isSameAsDocument<decltype(byNameVolume), double>(byNameVolume, doc, 2)));
+    unittest::ExpectTrue((isSameAsDocument<decltype(byPrice), t_priceConv>(byPrice, doc, 3)));
+    unittest::ExpectEqual(std::string, std::get<std::string>(byPrice.GetViewCell<t_priceConv>("Price", byPrice.GetViewRowCount() - 1)), "na");
+    unittest::ExpectEqual(int, byNameVolume.GetViewCell<int>("Volume", "r3"), 10);
+    ExpectException(byNameVolume.GetViewCell<int>("Volume", "r4"), std::out_of_range);
+
+    std::vector<int> volumes(byNameVolume.GetViewRowCount());
+    byNameVolume.GetViewColumn<int>("Volume", std::span<int>(volumes));
+    unittest::ExpectTrue(volumes == byNameVolume.GetViewColumn<int>("Volume"));
+
+    // lookups by sort-key
+    const std::tuple<int, std::string, int> row = byNameVolume.GetRow_IndexKey<int, std::string, int>(std::make_tuple(std::string("n3"), 10));
+    unittest::ExpectEqual(int, std::get<0>(row), 3);
+    unittest::ExpectEqual(std::string, std::get<1>(row), "n3");
+    unittest::ExpectEqual(int, std::get<2>(row), 10);
+    unittest::ExpectEqual(int, byNameVolume.GetCell_IndexKey<int>("Volume", std::make_tuple(std::string("n3"), 10)), 10);
+    unittest::ExpectEqual(int, byNameVolume.GetCell_IndexKey<int>("Id", std::make_tuple(std::string("n3"), 10)), 3);
+
+    // a view not refreshed after a change reads the Document, refreshed reads the cached sort-keys again
+    doc.SetCell<int>("Volume", "r3", 11);
+    unittest::ExpectEqual(int, byNameVolume.GetViewCell<int>("Volume", "r3"), 11);
+    byNameVolume.Refresh();
+    unittest::ExpectEqual(int, byNameVolume.GetViewCell<int>("Volume", "r3"), 11);
+    unittest::ExpectTrue((isSameAsDocument<decltype(byNameVolume), int>(byNameVolume, doc, 2)));
+    doc.SetCell<std::string>("Volume", "r3", "011");
+    byNameVolume.Refresh();
+    unittest::ExpectTrue((isSameAsDocument<decltype(byNameVolume), int>(byNameVolume, doc, 2)));
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
@@ -0,0 +1,60 @@
+// test124.cpp - set column and row on a document with ragged rows
+
+#include <rapidcsv/rapidcsv.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv = "A,B,C\n1,2,3\n4\n5,6,7\n";
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::Document doc(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    unittest::ExpectEqual(size_t, doc.GetRow_VecStr(1).size(), 1);
+
+    // short row is padded up to the column
+    doc.SetColumn<int>("C", { 10, 20, 30 });
+    unittest::ExpectEqual(size_t, doc.GetRow_VecStr(1).size(), 3);
+    unittest::ExpectEqual(int, doc.GetCell<int>("C", 1), 20);
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("B", 1), "");
+    unittest::ExpectEqual(int, doc.GetCell<int>("C", 2), 30);
+
+    // rvalue overload moves the strings into the padded short row
+    doc.Load(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    std::vector<std::string> columnC = { "11", "21", "31" };
+    doc.SetColumn<std::string>("C", std::move(columnC));
+    unittest::ExpectEqual(size_t, doc.GetRow_VecStr(1).size(), 3);
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("C", 1), "21");
+    unittest::ExpectEqual(std::string, doc.GetCell<std::string>("A", 1), "4");
+
+    // short row is padded up to the row size
+    doc.Load(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    doc.SetRow<int, int, int>(1, std::make_tuple(40, 50, 60));
+    unittest::ExpectEqual(int, doc.GetCell<int>("C", 1), 60);
+
+    doc.Load(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    doc.SetRow_VecStr(1, std::vector<std::string>{ "41", "51", "61" });
+    unittest::ExpectEqual(int, doc.GetCell<int>("C", 1), 61);
+
+    doc.Load(path, rapidcsv::LabelParams(rapidcsv::FlgColumnName::CN_PRESENT, rapidcsv::FlgRowName::RN_MISSING));
+    const std::vector<std::string> row1 = { "42", "52" };
+    doc.SetRow_VecStr(1, std::vector<std::string>(row1));
+    unittest::ExpectEqual(int, doc.GetCell<int>("B", 1), 52);
+    unittest::ExpectEqual(size_t, doc.GetRow_VecStr(1).size(), 2);
+    unittest::ExpectEqual(int, doc.GetCell<int>("A", 2), 5);
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}
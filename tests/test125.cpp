@@ -0,0 +1,91 @@
+// test125.cpp - columnar document, filter and sort on dictionary-encoded columns
+
+#include <rapidcsv/columnar.h>
+#include <rapidcsv/filterexpr.h>
+#include "unittest.h"
+
+int main()
+{
+  int rv = 0;
+
+  std::string csv =
+    "Ticker,Lot,Close\n"
+    "MSFT,10,370.87\n"
+    "IBM,5,163.55\n"
+    "AAPL,010,185.64\n"
+    "MSFT,20,370.60\n"
+    "IBM,x,162.58\n"
+    "AAPL,5,184.25\n"
+  ;
+
+  std::string path = unittest::TempPath();
+  unittest::WriteFile(path, csv);
+
+  try
+  {
+    rapidcsv::ColumnarDocument cdoc(path, rapidcsv::LabelParams(), rapidcsv::SeparatorParams(), rapidcsv::LineReaderParams(),
+                                    { "Ticker", "Lot" });
+
+    using rapidcsv::FilterExpr;
+    using rapidcsv::e_CompareOp;
+
+    // equality and IN-list on an encoded column, tested by code
+    const rapidcsv::FilterPlan msft = FilterExpr::Compare<std::string>("Ticker", e_CompareOp::EQUAL, "MSFT").Compile(cdoc);
+    unittest::ExpectTrue((msft.Select() == std::vector<size_t>{ 0, 3 }));
+    unittest::ExpectTrue(msft.Evaluate(3));
+    unittest::ExpectTrue(!msft.Evaluate(4));
+
+    const rapidcsv::FilterPlan aaplIbm = FilterExpr::In<std::string>("Ticker", { "AAPL", "IBM" }).Compile(cdoc);
+    unittest::ExpectTrue((aaplIbm.Select() == std::vector<size_t>{ 1, 2, 4, 5 }));
+    const std::vector<size_t> viewRowIdxs = { 5, 3, 1 };
+    unittest::ExpectTrue((aaplIbm.Select(viewRowIdxs) == std::vector<size_t>{ 5, 1 }));
+
+    // encoded and plain columns in one expression
+    const rapidcsv::FilterPlan msftHigh =
+      FilterExpr::Compare<std::string>(0, e_CompareOp::EQUAL, "MSFT")
+        .And(FilterExpr::Compare<double>("Close", e_CompareOp::GREATER, 370.7)).Compile(cdoc);
+    unittest::ExpectTrue((msftHigh.Select() == std::vector<size_t>{ 0 }));
+
+    // a value failing conversion throws only when a selected row has it
+    const rapidcsv::FilterPlan lot5 =
+      FilterExpr::Compare<std::string>("Ticker", e_CompareOp::EQUAL, "AAPL")
+        .And(FilterExpr::Compare<int>("Lot", e_CompareOp::EQUAL, 5)).Compile(cdoc);
+    unittest::ExpectTrue((lot5.Select() == std::vector<size_t>{ 5 }));
+    const rapidcsv::FilterPlan lotAll = FilterExpr::Compare<int>("Lot", e_CompareOp::EQUAL, 5).Compile(cdoc);
+    ExpectException(lotAll.Select(), std::invalid_argument);
+
+    // value added to the dictionary after compile
+    cdoc.SetCell<std::string>("Ticker", 1, "ORCL");
+    unittest::ExpectTrue((aaplIbm.Select() == std::vector<size_t>{ 2, 4, 5 }));
+    cdoc.SetCell<std::string>("Ticker", 1, "IBM");
+
+    // conversion per distinct value, gathered by code
+    cdoc.SetCell<std::string>("Lot", 4, "7");
+    const std::vector<int> lots = cdoc.GetColumn<int>("Lot");
+    unittest::ExpectTrue((lots == std::vector<int>{ 10, 5, 10, 20, 7, 5 }));
+
+    // sort by rank of code, "10" and "010" rank equal and are ordered by the next sort column
+    const std::vector<size_t> byLot =
+      cdoc.GetSortedRowIdxs(rapidcsv::SortParams<int>(1), rapidcsv::SortParams<double, rapidcsv::e_SortOrder::DESCEND>(2));
+    unittest::ExpectTrue((byLot == std::vector<size_t>{ 5, 1, 4, 0, 2, 3 }));
+
+    const std::vector<size_t> byTicker =
+      cdoc.GetSortedRowIdxs(rapidcsv::SortParams<std::string, rapidcsv::e_SortOrder::DESCEND>(0));
+    unittest::ExpectTrue((byTicker == std::vector<size_t>{ 0, 3, 1, 4, 2, 5 }));
+
+    // encodedness changed after compile
+    cdoc.DecodeColumn("Ticker");
+    ExpectException(msft.Select(), std::out_of_range);
+    const rapidcsv::FilterPlan msftPlain = FilterExpr::Compare<std::string>("Ticker", e_CompareOp::EQUAL, "MSFT").Compile(cdoc);
+    unittest::ExpectTrue((msftPlain.Select() == std::vector<size_t>{ 0, 3 }));
+  }
+  catch (const std::exception& ex)
+  {
+    std::cout << ex.what() << std::endl;
+    rv = 1;
+  }
+
+  unittest::DeleteFile(path);
+
+  return rv;
+}